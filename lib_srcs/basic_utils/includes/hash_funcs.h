@@ -2,6 +2,7 @@
 #define HASH_FUNCS_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief
@@ -13,4 +14,129 @@
  */
 size_t djb2Hash(const void *str);
 
+/**
+ * @brief
+ *  Finalizer that mixes the bits of a hash so that every input bit affects
+ *  both the low and high bits of the result. Used to spread out weak hashes.
+ *
+ * @param[in] hash  hash to mix
+ *
+ * @return mixed hash
+ */
+size_t mixHash(size_t hash);
+
+/**
+ * @brief
+ *  hash function for arbitrary bytes using the wyhash algorithm, which reads
+ *  8 to 48 bytes per iteration. Values differ between little and big endian
+ *  machines.
+ *
+ * @param[in] key   bytes to hash
+ * @param[in] len   number of bytes
+ *
+ * @return hashed index
+ */
+size_t wyHash(const void *key, size_t len);
+
+/**
+ * @brief
+ *  wyHash with a seed, so that hashes can't be predicted without it.
+ *
+ * @param[in] key   bytes to hash
+ * @param[in] len   number of bytes
+ * @param[in] seed  seed to hash with
+ *
+ * @return hashed index
+ */
+size_t wyHashSeeded(const void *key, size_t len, size_t seed);
+
+/**
+ * @brief
+ *  hash function for strings using wyHash, usable in place of djb2Hash.
+ *
+ * @param[in] str   string to hash
+ *
+ * @return hashed index
+ */
+size_t wyStrHash(const void *str);
+
+/**
+ * @brief
+ *  hash function for an unsigned integer of 1, 2, 4 or 8 bytes, mixing it
+ *  with mixHash. Other lengths are hashed with wyHash.
+ *
+ * @param[in] key   integer to hash
+ * @param[in] len   size of the integer in bytes
+ *
+ * @return hashed index
+ */
+size_t intHash(const void *key, size_t len);
+
+/**
+ * @brief
+ *  hash function for the address of a pointer rather than what it points to,
+ *  mixing it with mixHash.
+ *
+ * @param[in] ptr   pointer to hash
+ *
+ * @return hashed index
+ */
+size_t ptrHash(const void *ptr);
+
+/**
+ * @brief
+ *  hash function for arbitrary bytes using SipHash-2-4, a keyed
+ *  pseudorandom function. Slower than wyHash, but its hashes can't be made
+ *  to collide on purpose without knowing the key, so it's meant for tables
+ *  whose keys come from untrusted input.
+ *
+ * @param[in] key   bytes to hash
+ * @param[in] len   number of bytes
+ * @param[in] k0    first half of the 128 bit key
+ * @param[in] k1    second half of the 128 bit key
+ *
+ * @return hashed index
+ */
+size_t sipHash(const void *key, size_t len, uint64_t k0, uint64_t k1);
+
+/**
+ * @brief
+ *  Seeded hash function for strings using wyHashSeeded, for the seeded hash
+ *  of a hashtable.
+ *
+ * @param[in] str   string to hash
+ * @param[in] seed  seed of the hashtable
+ *
+ * @return hashed index
+ */
+size_t wyStrHashSeeded(const void *str, size_t seed);
+
+/**
+ * @brief
+ *  Seeded hash function for strings using sipHash keyed by the seed, for the
+ *  seeded hash of a hashtable holding untrusted keys.
+ *
+ * @note
+ *  Both halves of the key are derived from the one seed, the second as
+ *  mixHash(seed), so the key is only as hard to guess as a size_t rather
+ *  than the full 128 bits. Call sipHash with a 128 bit key where that
+ *  matters.
+ *
+ * @param[in] str   string to hash
+ * @param[in] seed  seed of the hashtable
+ *
+ * @return hashed index
+ */
+size_t sipStrHash(const void *str, size_t seed);
+
+/**
+ * @brief
+ *  Gets a seed for hashing that differs between processes and calls. Read
+ *  from /dev/urandom when it exists, otherwise made from the time, the
+ *  address space layout and a counter.
+ *
+ * @return random seed
+ */
+size_t randomSeed(void);
+
 #endif
\ No newline at end of file
@@ -1,4 +1,21 @@
 #include "hash_funcs.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const uint64_t _wy_secret[4] = {0x2d358dccaa6c78a5ULL,
+                                       0x8bb84b93962eacc9ULL,
+                                       0x4b33a62ed433d4a3ULL,
+                                       0x4d5a2da51de1aa47ULL};
+
+static void _wyMum(uint64_t *a, uint64_t *b);
+static uint64_t _wyMix(uint64_t a, uint64_t b);
+static uint64_t _wyRead8(const unsigned char *p);
+static uint64_t _wyRead4(const unsigned char *p);
+static uint64_t _rotateLeft(uint64_t value, unsigned int bits);
+static void _sipRounds(uint64_t v[4], unsigned int rounds);
 
 size_t djb2Hash(const void *str)
 {
@@ -7,4 +24,250 @@ size_t djb2Hash(const void *str)
         hash = ((hash << 5) + hash) + ((char *)str)[i]; /* hash*33 + c */
     }
     return hash;
+}
+
+size_t mixHash(size_t hash)
+{
+#if SIZE_MAX > UINT32_MAX
+    hash ^= hash >> 33; /* murmur3 fmix64 */
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+#else
+    hash ^= hash >> 16; /* murmur3 fmix32 */
+    hash *= 0x85ebca6bUL;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35UL;
+    hash ^= hash >> 16;
+#endif
+    return hash;
+}
+
+size_t wyHash(const void *key, size_t len)
+{
+    return wyHashSeeded(key, len, 0);
+}
+
+size_t wyHashSeeded(const void *key, size_t len, size_t seed)
+{
+    const unsigned char *p = key;
+    uint64_t hash = seed ^ _wyMix(seed ^ _wy_secret[0], _wy_secret[1]);
+    uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            size_t mid = (len >> 3) << 2;
+            a = (_wyRead4(p) << 32) | _wyRead4(p + mid);
+            b = (_wyRead4(p + len - 4) << 32) | _wyRead4(p + len - 4 - mid);
+        } else if (len > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8)
+                | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            uint64_t hash_1 = hash, hash_2 = hash;
+            do {
+                hash = _wyMix(_wyRead8(p) ^ _wy_secret[1],
+                              _wyRead8(p + 8) ^ hash);
+                hash_1 = _wyMix(_wyRead8(p + 16) ^ _wy_secret[2],
+                                _wyRead8(p + 24) ^ hash_1);
+                hash_2 = _wyMix(_wyRead8(p + 32) ^ _wy_secret[3],
+                                _wyRead8(p + 40) ^ hash_2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            hash ^= hash_1 ^ hash_2;
+        }
+        while (i > 16) {
+            hash = _wyMix(_wyRead8(p) ^ _wy_secret[1], _wyRead8(p + 8) ^ hash);
+            p += 16;
+            i -= 16;
+        }
+        a = _wyRead8(p + i - 16);
+        b = _wyRead8(p + i - 8);
+    }
+    a ^= _wy_secret[1];
+    b ^= hash;
+    _wyMum(&a, &b);
+    return _wyMix(a ^ _wy_secret[0] ^ len, b ^ _wy_secret[1]);
+}
+
+size_t wyStrHash(const void *str)
+{
+    return wyHashSeeded(str, strlen(str), 0);
+}
+
+size_t intHash(const void *key, size_t len)
+{
+    uint64_t value;
+    switch (len) {
+    case 1: {
+        uint8_t int_8;
+        memcpy(&int_8, key, len);
+        value = int_8;
+        break;
+    }
+    case 2: {
+        uint16_t int_16;
+        memcpy(&int_16, key, len);
+        value = int_16;
+        break;
+    }
+    case 4: {
+        uint32_t int_32;
+        memcpy(&int_32, key, len);
+        value = int_32;
+        break;
+    }
+    case 8:
+        memcpy(&value, key, len);
+        break;
+    default:
+        return wyHash(key, len);
+    }
+#if SIZE_MAX > UINT32_MAX
+    return mixHash(value);
+#else
+    return mixHash((size_t)(value ^ (value >> 32)));
+#endif
+}
+
+size_t ptrHash(const void *ptr)
+{
+    return mixHash((uintptr_t)ptr);
+}
+
+size_t sipHash(const void *key, size_t len, uint64_t k0, uint64_t k1)
+{
+    const unsigned char *p = key;
+    uint64_t v[4] = {k0 ^ 0x736f6d6570736575ULL, k1 ^ 0x646f72616e646f6dULL,
+                     k0 ^ 0x6c7967656e657261ULL, k1 ^ 0x7465646279746573ULL};
+    size_t end = len - len % 8;
+    for (size_t i = 0; i < end; i += 8) {
+        uint64_t block = 0;
+        for (unsigned int j = 0; j < 8; j++) { /* little endian */
+            block |= (uint64_t)p[i + j] << (8 * j);
+        }
+        v[3] ^= block;
+        _sipRounds(v, 2);
+        v[0] ^= block;
+    }
+    uint64_t last = (uint64_t)len << 56;
+    for (size_t j = 0; end + j < len; j++) {
+        last |= (uint64_t)p[end + j] << (8 * j);
+    }
+    v[3] ^= last;
+    _sipRounds(v, 2);
+    v[0] ^= last;
+    v[2] ^= 0xff;
+    _sipRounds(v, 4);
+    return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+size_t wyStrHashSeeded(const void *str, size_t seed)
+{
+    return wyHashSeeded(str, strlen(str), seed);
+}
+
+size_t sipStrHash(const void *str, size_t seed)
+{
+    return sipHash(str, strlen(str), seed, mixHash(seed));
+}
+
+size_t randomSeed(void)
+{
+    static atomic_size_t calls = 0;
+    size_t seed;
+    FILE *urandom = fopen("/dev/urandom", "rb");
+    if (urandom != NULL) {
+        size_t read = fread(&seed, sizeof(seed), 1, urandom);
+        fclose(urandom);
+        if (read == 1) {
+            return seed;
+        }
+    }
+    seed = (size_t)time(NULL) ^ ((size_t)clock() << 16) ^ (uintptr_t)&seed;
+    return mixHash(seed ^ mixHash(atomic_fetch_add(&calls, 1) + 1));
+}
+
+/**
+ * @brief
+ *  Multiplies a and b into 128 bits, storing the low half in a and the high
+ *  half in b.
+ */
+static void _wyMum(uint64_t *a, uint64_t *b)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    uint64_t a_hi = *a >> 32, a_lo = (uint32_t)*a;
+    uint64_t b_hi = *b >> 32, b_lo = (uint32_t)*b;
+    uint64_t hi = a_hi * b_hi, mid_1 = a_hi * b_lo, mid_2 = b_hi * a_lo;
+    uint64_t lo = a_lo * b_lo;
+    uint64_t sum = lo + (mid_1 << 32);
+    uint64_t carry = sum < lo;
+    lo = sum + (mid_2 << 32);
+    carry += lo < sum;
+    *a = lo;
+    *b = hi + (mid_1 >> 32) + (mid_2 >> 32) + carry;
+#endif
+}
+
+/**
+ * @brief
+ *  Multiplies a and b into 128 bits and folds the halves together.
+ */
+static uint64_t _wyMix(uint64_t a, uint64_t b)
+{
+    _wyMum(&a, &b);
+    return a ^ b;
+}
+
+static uint64_t _wyRead8(const unsigned char *p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint64_t _wyRead4(const unsigned char *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint64_t _rotateLeft(uint64_t value, unsigned int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @brief
+ *  Applies a number of SipRounds to the SipHash state.
+ */
+static void _sipRounds(uint64_t v[4], unsigned int rounds)
+{
+    for (unsigned int i = 0; i < rounds; i++) {
+        v[0] += v[1];
+        v[1] = _rotateLeft(v[1], 13);
+        v[1] ^= v[0];
+        v[0] = _rotateLeft(v[0], 32);
+        v[2] += v[3];
+        v[3] = _rotateLeft(v[3], 16);
+        v[3] ^= v[2];
+        v[0] += v[3];
+        v[3] = _rotateLeft(v[3], 21);
+        v[3] ^= v[0];
+        v[2] += v[1];
+        v[1] = _rotateLeft(v[1], 17);
+        v[1] ^= v[2];
+        v[2] = _rotateLeft(v[2], 32);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include "hash_funcs.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WY_VECTOR_COUNT 7
+#define SIP_VECTOR_COUNT 16
+
+// published wyhash test vectors, each hashed with its index as the seed
+static const char *wy_msgs[WY_VECTOR_COUNT]
+    = {"",
+       "a",
+       "abc",
+       "message digest",
+       "abcdefghijklmnopqrstuvwxyz",
+       "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+       "123456789012345678901234567890123456789012345678901234567890123456"
+       "78901234567890"};
+static const uint64_t wy_hashes[WY_VECTOR_COUNT]
+    = {0x93228a4de0eec5a2ULL, 0xc5bac3db178713c4ULL, 0xa97f2f7b1d9b3314ULL,
+       0x786d1f1df3801df4ULL, 0xdca5a8138ad37c87ULL, 0xb9e734f117cfaf70ULL,
+       0x6cc5eab49a92d617ULL};
+
+// SipHash-2-4 reference vectors, hashing bytes 00..i-1 with key 00..0f
+static const uint64_t sip_hashes[SIP_VECTOR_COUNT]
+    = {0x726fdb47dd0e0e31ULL, 0x74f839c593dc67fdULL, 0x0d6c8009d9a94f5aULL,
+       0x85676696d7fb7e2dULL, 0xcf2794e0277187b7ULL, 0x18765564cd99a68dULL,
+       0xcbc9466e58fee3ceULL, 0xab0200f58b01d137ULL, 0x93f5f5799a932462ULL,
+       0x9e0082df0ba9e4b0ULL, 0x7a5dbbc594ddb9f3ULL, 0xf4b32f46226bada7ULL,
+       0x751e8fbc860ee5fbULL, 0x14ea5627c0843d90ULL, 0xf723ca908e7af2eeULL,
+       0xa129ca6149be45e5ULL};
+
+static bool _test_wyHashSeeded()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    for (size_t i = 0; i < WY_VECTOR_COUNT; i++) {
+        size_t res = wyHashSeeded(wy_msgs[i], strlen(wy_msgs[i]), i);
+        if (res != wy_hashes[i]) {
+            is_ok = false;
+            printf("msg: \"%s\" \t->\t res: %zx | ans: %llx\n", wy_msgs[i],
+                   res, (unsigned long long)wy_hashes[i]);
+        }
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_wyHash()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    for (size_t i = 0; i < WY_VECTOR_COUNT; i++) {
+        size_t len = strlen(wy_msgs[i]);
+        size_t ans = wyHashSeeded(wy_msgs[i], len, 0);
+        if (wyHash(wy_msgs[i], len) != ans || wyStrHash(wy_msgs[i]) != ans) {
+            is_ok = false;
+            printf("msg: \"%s\" \t->\t res: differs | ans: %zx\n", wy_msgs[i],
+                   ans);
+        }
+    }
+    if (wyHash("", 0) != wy_hashes[0]) {
+        is_ok = false;
+        printf("empty: res: %zx | ans: %llx\n", wyHash("", 0),
+               (unsigned long long)wy_hashes[0]);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_intHash()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    // an integer hashes the same whatever its width
+    uint8_t int_8 = 200;
+    uint16_t int_16 = 200;
+    uint32_t int_32 = 200;
+    uint64_t int_64 = 200;
+    size_t ans = mixHash(200);
+    size_t res[4] = {intHash(&int_8, 1), intHash(&int_16, 2),
+                     intHash(&int_32, 4), intHash(&int_64, 8)};
+    for (size_t i = 0; i < 4; i++) {
+        if (res[i] != ans) {
+            is_ok = false;
+            printf("bytes: %d \t->\t res: %zx | ans: %zx\n", 1 << i, res[i],
+                   ans);
+        }
+    }
+    unsigned char bytes[3] = {1, 2, 3};
+    if (intHash(bytes, 3) != wyHash(bytes, 3)) {
+        is_ok = false;
+        printf("bytes: 3 \t->\t res: %zx | ans: %zx\n", intHash(bytes, 3),
+               wyHash(bytes, 3));
+    }
+    int_64 = 201;
+    if (intHash(&int_64, 8) == ans) {
+        is_ok = false;
+        printf("201: res: %zx | ans: not %zx\n", intHash(&int_64, 8), ans);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ptrHash()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    int values[2];
+    if (ptrHash(&values[0]) != mixHash((uintptr_t)&values[0])
+        || ptrHash(&values[0]) == ptrHash(&values[1])) {
+        is_ok = false;
+        printf("ptr: res: %zx | ans: %zx\n", ptrHash(&values[0]),
+               mixHash((uintptr_t)&values[0]));
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_sipHash()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    unsigned char msg[SIP_VECTOR_COUNT];
+    for (size_t i = 0; i < SIP_VECTOR_COUNT; i++) {
+        msg[i] = i;
+    }
+    uint64_t k0 = 0x0706050403020100ULL, k1 = 0x0f0e0d0c0b0a0908ULL;
+    for (size_t i = 0; i < SIP_VECTOR_COUNT; i++) {
+        size_t res = sipHash(msg, i, k0, k1);
+        if (res != sip_hashes[i]) {
+            is_ok = false;
+            printf("len: %lu \t->\t res: %zx | ans: %llx\n", i, res,
+                   (unsigned long long)sip_hashes[i]);
+        }
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_seededStrHash()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    const char *str = wy_msgs[3];
+    if (wyStrHashSeeded(str, 3) != wy_hashes[3]) {
+        is_ok = false;
+        printf("wy: res: %zx | ans: %llx\n", wyStrHashSeeded(str, 3),
+               (unsigned long long)wy_hashes[3]);
+    }
+    size_t ans = sipHash(str, strlen(str), 42, mixHash(42));
+    if (sipStrHash(str, 42) != ans || sipStrHash(str, 43) == ans) {
+        is_ok = false;
+        printf("sip: res: %zx | ans: %zx\n", sipStrHash(str, 42), ans);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_wyHashSeeded();
+    is_ok &= _test_wyHash();
+    is_ok &= _test_intHash();
+    is_ok &= _test_ptrHash();
+    is_ok &= _test_sipHash();
+    is_ok &= _test_seededStrHash();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
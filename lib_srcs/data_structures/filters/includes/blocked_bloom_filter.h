@@ -0,0 +1,79 @@
+/**
+ * @file blocked_bloom_filter.h
+ *
+ * @brief
+ *  Structs and functions for blocked Bloom filters. Each key sets one bit in
+ *  each of the 8 words of a single cache line block, so a lookup loads one
+ *  line and does no branching on the bits. Meant to sit in front of a
+ *  hashtable whose lookups mostly miss:
+ *
+ *      if (!BlockedBloomFilterMayContain(filter, key)) {
+ *          return NULL;
+ *      }
+ *      return RobinHashTableFind(table, key);
+ *
+ *  With 10 bits per key about 1% of the misses still reach the table.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef BLOCKED_BLOOM_FILTER_H
+#define BLOCKED_BLOOM_FILTER_H
+
+#include "filter_block.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct BlockedBloomFilter {
+    FilterBlock_t *blocks; // array of cache line blocks of bits
+    size_t block_count;    // length of the block array
+    size_t (*hash)(const void *);
+} BlockedBloomFilter_t;
+
+/**
+ * @brief
+ *  Creates an empty blocked Bloom filter sized for a number of keys.
+ *
+ * @param[in] key_count     number of keys expected to be added
+ * @param[in] bits_per_key  bits to allocate per key; 8 to 16 is typical
+ * @param[in] hash_func     function to hash keys
+ *
+ * @return New blocked Bloom filter. NULL if unable to allocate memory.
+ */
+extern BlockedBloomFilter_t *
+BlockedBloomFilterCreate(size_t key_count, size_t bits_per_key,
+                         size_t (*hash_func)(const void *));
+
+/**
+ * @brief
+ *  Deletes a blocked Bloom filter.
+ *
+ * @param[in,out] p_filter  blocked Bloom filter to delete
+ */
+extern void BlockedBloomFilterClear(BlockedBloomFilter_t **p_filter);
+
+/**
+ * @brief
+ *  Adds a key to a blocked Bloom filter. Keys can't be removed.
+ *
+ * @param[in,out] filter    blocked Bloom filter to add to
+ * @param[in]     key       key to add
+ */
+extern void BlockedBloomFilterAdd(BlockedBloomFilter_t *filter,
+                                  const void *key);
+
+/**
+ * @brief
+ *  Checks if a key may have been added to a blocked Bloom filter.
+ *
+ * @param[in] filter        blocked Bloom filter to search
+ * @param[in] key           key to find
+ *
+ * @return
+ *  true  : the key may have been added @n
+ *  false : the key was never added @n
+ */
+extern bool BlockedBloomFilterMayContain(const BlockedBloomFilter_t *filter,
+                                         const void *key);
+#endif
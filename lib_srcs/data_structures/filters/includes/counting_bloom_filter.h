@@ -0,0 +1,92 @@
+/**
+ * @file counting_bloom_filter.h
+ *
+ * @brief
+ *  Structs and functions for blocked counting Bloom filters. Each word of a
+ *  cache line block packs 16 counters of 4 bits instead of 64 bits, and a
+ *  key counts up one counter in each of the 8 words of its block, so keys
+ *  can be removed again. A counter that reaches COUNT_BLOOM_MAX sticks there,
+ *  as the keys behind it are no longer known.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef COUNTING_BLOOM_FILTER_H
+#define COUNTING_BLOOM_FILTER_H
+
+#include "filter_block.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define COUNT_BLOOM_MAX 15 // value a counter saturates at
+
+typedef struct CountingBloomFilter {
+    FilterBlock_t *blocks; // array of cache line blocks of counters
+    size_t block_count;    // length of the block array
+    size_t (*hash)(const void *);
+} CountingBloomFilter_t;
+
+/**
+ * @brief
+ *  Creates an empty counting Bloom filter sized for a number of keys.
+ *
+ * @param[in] key_count         number of keys expected to be added
+ * @param[in] counters_per_key  counters to allocate per key, 4 bits each;
+ *                              8 to 16 is typical
+ * @param[in] hash_func         function to hash keys
+ *
+ * @return New counting Bloom filter. NULL if unable to allocate memory.
+ */
+extern CountingBloomFilter_t *
+CountingBloomFilterCreate(size_t key_count, size_t counters_per_key,
+                          size_t (*hash_func)(const void *));
+
+/**
+ * @brief
+ *  Deletes a counting Bloom filter.
+ *
+ * @param[in,out] p_filter  counting Bloom filter to delete
+ */
+extern void CountingBloomFilterClear(CountingBloomFilter_t **p_filter);
+
+/**
+ * @brief
+ *  Adds a key to a counting Bloom filter. A key added twice must be removed
+ *  twice.
+ *
+ * @param[in,out] filter    counting Bloom filter to add to
+ * @param[in]     key       key to add
+ */
+extern void CountingBloomFilterAdd(CountingBloomFilter_t *filter,
+                                   const void *key);
+
+/**
+ * @brief
+ *  Removes a key from a counting Bloom filter. Only keys that were added may
+ *  be removed, or other keys can be lost from the filter.
+ *
+ * @param[in,out] filter    counting Bloom filter to remove from
+ * @param[in]     key       key to remove
+ *
+ * @return
+ *  true  : removed successfully @n
+ *  false : the key was never added, the filter is unchanged @n
+ */
+extern bool CountingBloomFilterRemove(CountingBloomFilter_t *filter,
+                                      const void *key);
+
+/**
+ * @brief
+ *  Checks if a key may be in a counting Bloom filter.
+ *
+ * @param[in] filter        counting Bloom filter to search
+ * @param[in] key           key to find
+ *
+ * @return
+ *  true  : the key may be in the filter @n
+ *  false : the key isn't in the filter @n
+ */
+extern bool CountingBloomFilterMayContain(const CountingBloomFilter_t *filter,
+                                          const void *key);
+#endif
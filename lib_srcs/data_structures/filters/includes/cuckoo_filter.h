@@ -0,0 +1,105 @@
+/**
+ * @file cuckoo_filter.h
+ *
+ * @brief
+ *  Structs and functions for cuckoo filters. Each key is stored as a 16 bit
+ *  fingerprint in one of two buckets of 4, the second found from the first
+ *  and the fingerprint alone, so fingerprints can be moved between them
+ *  without the key. Supports removal like a counting Bloom filter in a
+ *  quarter of the space, with about 0.01% false positives, at the cost of
+ *  looking in two cache lines instead of one.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef CUCKOO_FILTER_H
+#define CUCKOO_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CUCKOO_FILTER_SLOTS 4 // fingerprints per bucket
+#define CUCKOO_FILTER_MAX_KICKS 500 // fingerprints moved before giving up
+#define CUCKOO_FILTER_LOAD 0.9      // load the filter is sized for
+
+typedef struct CuckooFilter {
+    uint16_t (*buckets)[CUCKOO_FILTER_SLOTS]; // array of buckets of
+                                              // fingerprints; 0 if empty
+    size_t mask;  // number of buckets - 1; a power of 2 - 1
+    size_t count; // number of fingerprints stored, including the victim
+    struct {
+        uint16_t fingerprint;
+        size_t i;
+        bool is_used;
+    } victim; // fingerprint left over by a failed add, still found by
+              // lookups; the filter is full while it's used
+    uint64_t rand_state; // state of the xorshift choosing what to move
+    size_t (*hash)(const void *);
+} CuckooFilter_t;
+
+/**
+ * @brief
+ *  Creates an empty cuckoo filter sized for a number of keys.
+ *
+ * @param[in] key_count     number of keys expected to be added
+ * @param[in] hash_func     function to hash keys
+ *
+ * @return New cuckoo filter. NULL if unable to allocate memory.
+ */
+extern CuckooFilter_t *CuckooFilterCreate(size_t key_count,
+                                          size_t (*hash_func)(const void *));
+
+/**
+ * @brief
+ *  Deletes a cuckoo filter.
+ *
+ * @param[in,out] p_filter  cuckoo filter to delete
+ */
+extern void CuckooFilterClear(CuckooFilter_t **p_filter);
+
+/**
+ * @brief
+ *  Adds a key to a cuckoo filter, moving other fingerprints to their other
+ *  bucket to make room. A key added twice is stored twice and must be
+ *  removed twice. If no room is found after CUCKOO_FILTER_MAX_KICKS moves,
+ *  the key is still added but the filter becomes full.
+ *
+ * @param[in,out] filter    cuckoo filter to add to
+ * @param[in]     key       key to add
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : the filter is full @n
+ */
+extern bool CuckooFilterAdd(CuckooFilter_t *filter, const void *key);
+
+/**
+ * @brief
+ *  Removes a key from a cuckoo filter. Only keys that were added may be
+ *  removed, or another key with the same fingerprint can be lost.
+ *
+ * @param[in,out] filter    cuckoo filter to remove from
+ * @param[in]     key       key to remove
+ *
+ * @return
+ *  true  : removed successfully @n
+ *  false : the key isn't in the filter @n
+ */
+extern bool CuckooFilterRemove(CuckooFilter_t *filter, const void *key);
+
+/**
+ * @brief
+ *  Checks if a key may be in a cuckoo filter.
+ *
+ * @param[in] filter        cuckoo filter to search
+ * @param[in] key           key to find
+ *
+ * @return
+ *  true  : the key may be in the filter @n
+ *  false : the key isn't in the filter @n
+ */
+extern bool CuckooFilterMayContain(const CuckooFilter_t *filter,
+                                   const void *key);
+#endif
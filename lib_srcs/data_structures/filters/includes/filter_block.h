@@ -0,0 +1,86 @@
+/**
+ * @file filter_block.h
+ *
+ * @brief
+ *  Cache line blocks and inline functions for reducing hashes to them,
+ *  shared by the Bloom filters. A key only touches the one block its hash
+ *  picks, and one bit or counter in each word of that block.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef FILTER_BLOCK_H
+#define FILTER_BLOCK_H
+
+#include "hash_funcs.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define FILTER_ALIGN 64 // blocks are aligned to a cache line so a lookup
+                        // only loads one line
+#define FILTER_WORDS 8  // 64 bit words in a block
+
+typedef struct FilterBlock { // cache line of a blocked filter
+    _Alignas(FILTER_ALIGN) uint64_t words[FILTER_WORDS];
+} FilterBlock_t;
+
+/**
+ * Odd constants multiplied with the low half of a key's hash to pick a
+ * different bit of it for each word of a block, as in the split block Bloom
+ * filters of Impala and Parquet.
+ */
+static const uint32_t FILTER_SALTS[FILTER_WORDS]
+    = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+       0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+/**
+ * @brief
+ *  Mixes a hash into 64 bits: the high half picks a block and the low half
+ *  the bits in it. Mixing keeps a filter independent of the indices a
+ *  hashtable derives from the same hash.
+ *
+ * @param[in] hash      hash of the key
+ *
+ * @return Mixed 64 bit hash.
+ */
+static inline uint64_t FilterMix(size_t hash)
+{
+#if SIZE_MAX > UINT32_MAX
+    return mixHash(hash);
+#else
+    return ((uint64_t)mixHash(hash) << 32) | mixHash(~hash);
+#endif
+}
+
+/**
+ * @brief
+ *  Reduces the high half of a mixed hash to a block index with Lemire's
+ *  multiply and shift, without a division.
+ *
+ * @param[in] hash      mixed hash of the key
+ * @param[in] count     number of blocks; at most 2^32
+ *
+ * @return Block index in [0, count).
+ */
+static inline size_t FilterBlockIndex(uint64_t hash, size_t count)
+{
+    return ((hash >> 32) * (uint64_t)count) >> 32;
+}
+
+/**
+ * @brief
+ *  Picks the position of a key's bit or counter in one word of a block.
+ *
+ * @param[in] hash      mixed hash of the key
+ * @param[in] word      index of the word in the block
+ * @param[in] bits      log2 of the number of positions in a word
+ *
+ * @return Position in [0, 2^bits).
+ */
+static inline unsigned int FilterWordShift(uint64_t hash, size_t word,
+                                           unsigned int bits)
+{
+    return ((uint32_t)hash * FILTER_SALTS[word]) >> (32 - bits);
+}
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file blocked_bloom_filter.c
+ *
+ * @brief
+ *  Structs and functions for blocked Bloom filters.
+ *
+ * @implements
+ *  blocked_bloom_filter.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "blocked_bloom_filter.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BITS_PER_BLOCK (FILTER_WORDS * 64)
+#define WORD_BITS_LOG 6 // log2 of the bits in a word
+
+BlockedBloomFilter_t *
+BlockedBloomFilterCreate(size_t key_count, size_t bits_per_key,
+                         size_t (*hash_func)(const void *))
+{
+    assert(hash_func != NULL);
+
+    assert(bits_per_key == 0 || key_count <= SIZE_MAX / bits_per_key);
+    size_t bit_count = key_count * bits_per_key;
+    size_t block_count
+        = bit_count / BITS_PER_BLOCK + (bit_count % BITS_PER_BLOCK != 0);
+    if (block_count == 0) {
+        block_count = 1;
+    }
+    assert(block_count <= UINT32_MAX);
+    BlockedBloomFilter_t *filter = malloc(sizeof(BlockedBloomFilter_t));
+    if (filter == NULL) {
+        return NULL;
+    }
+    filter->blocks
+        = aligned_alloc(FILTER_ALIGN, block_count * sizeof(FilterBlock_t));
+    if (filter->blocks == NULL) {
+        free(filter);
+        return NULL;
+    }
+    memset(filter->blocks, 0, block_count * sizeof(FilterBlock_t));
+    filter->block_count = block_count;
+    filter->hash = hash_func;
+    return filter;
+}
+
+void BlockedBloomFilterClear(BlockedBloomFilter_t **p_filter)
+{
+    assert(p_filter != NULL);
+    assert(*p_filter != NULL);
+
+    free((*p_filter)->blocks);
+    free(*p_filter);
+    *p_filter = NULL;
+}
+
+void BlockedBloomFilterAdd(BlockedBloomFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    uint64_t hash = FilterMix(filter->hash(key));
+    FilterBlock_t *block
+        = &filter->blocks[FilterBlockIndex(hash, filter->block_count)];
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        block->words[i] |= (uint64_t)1
+                           << FilterWordShift(hash, i, WORD_BITS_LOG);
+    }
+}
+
+bool BlockedBloomFilterMayContain(const BlockedBloomFilter_t *filter,
+                                  const void *key)
+{
+    assert(filter != NULL);
+
+    uint64_t hash = FilterMix(filter->hash(key));
+    const FilterBlock_t *block
+        = &filter->blocks[FilterBlockIndex(hash, filter->block_count)];
+    uint64_t is_set = 1;
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        is_set &= block->words[i] >> FilterWordShift(hash, i, WORD_BITS_LOG);
+    }
+    return is_set != 0;
+}
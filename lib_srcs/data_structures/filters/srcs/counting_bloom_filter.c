@@ -0,0 +1,140 @@
+/**
+ * @file counting_bloom_filter.c
+ *
+ * @brief
+ *  Structs and functions for blocked counting Bloom filters.
+ *
+ * @implements
+ *  counting_bloom_filter.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "counting_bloom_filter.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COUNTERS_PER_BLOCK (FILTER_WORDS * 16)
+#define WORD_COUNTERS_LOG 4 // log2 of the counters in a word
+#define COUNTER_BITS 4
+
+static FilterBlock_t *_findBlock(const CountingBloomFilter_t *filter,
+                                 uint64_t hash);
+static unsigned int _getCounter(const FilterBlock_t *block, size_t i,
+                                uint64_t hash);
+
+CountingBloomFilter_t *
+CountingBloomFilterCreate(size_t key_count, size_t counters_per_key,
+                          size_t (*hash_func)(const void *))
+{
+    assert(hash_func != NULL);
+
+    assert(counters_per_key == 0 || key_count <= SIZE_MAX / counters_per_key);
+    size_t counter_count = key_count * counters_per_key;
+    size_t block_count = counter_count / COUNTERS_PER_BLOCK
+                         + (counter_count % COUNTERS_PER_BLOCK != 0);
+    if (block_count == 0) {
+        block_count = 1;
+    }
+    assert(block_count <= UINT32_MAX);
+    CountingBloomFilter_t *filter = malloc(sizeof(CountingBloomFilter_t));
+    if (filter == NULL) {
+        return NULL;
+    }
+    filter->blocks
+        = aligned_alloc(FILTER_ALIGN, block_count * sizeof(FilterBlock_t));
+    if (filter->blocks == NULL) {
+        free(filter);
+        return NULL;
+    }
+    memset(filter->blocks, 0, block_count * sizeof(FilterBlock_t));
+    filter->block_count = block_count;
+    filter->hash = hash_func;
+    return filter;
+}
+
+void CountingBloomFilterClear(CountingBloomFilter_t **p_filter)
+{
+    assert(p_filter != NULL);
+    assert(*p_filter != NULL);
+
+    free((*p_filter)->blocks);
+    free(*p_filter);
+    *p_filter = NULL;
+}
+
+void CountingBloomFilterAdd(CountingBloomFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    uint64_t hash = FilterMix(filter->hash(key));
+    FilterBlock_t *block = _findBlock(filter, hash);
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        if (_getCounter(block, i, hash) < COUNT_BLOOM_MAX) {
+            block->words[i]
+                += (uint64_t)1
+                   << (FilterWordShift(hash, i, WORD_COUNTERS_LOG)
+                       * COUNTER_BITS);
+        }
+    }
+}
+
+bool CountingBloomFilterRemove(CountingBloomFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    uint64_t hash = FilterMix(filter->hash(key));
+    FilterBlock_t *block = _findBlock(filter, hash);
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        if (_getCounter(block, i, hash) == 0) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        if (_getCounter(block, i, hash) < COUNT_BLOOM_MAX) {
+            block->words[i]
+                -= (uint64_t)1
+                   << (FilterWordShift(hash, i, WORD_COUNTERS_LOG)
+                       * COUNTER_BITS);
+        }
+    }
+    return true;
+}
+
+bool CountingBloomFilterMayContain(const CountingBloomFilter_t *filter,
+                                   const void *key)
+{
+    assert(filter != NULL);
+
+    uint64_t hash = FilterMix(filter->hash(key));
+    const FilterBlock_t *block = _findBlock(filter, hash);
+    bool is_set = true;
+    for (size_t i = 0; i < FILTER_WORDS; i++) {
+        is_set &= _getCounter(block, i, hash) != 0;
+    }
+    return is_set;
+}
+
+/**
+ * @brief
+ *  Finds the block of a key from its mixed hash.
+ */
+static FilterBlock_t *_findBlock(const CountingBloomFilter_t *filter,
+                                 uint64_t hash)
+{
+    return &filter->blocks[FilterBlockIndex(hash, filter->block_count)];
+}
+
+/**
+ * @brief
+ *  Gets the counter of a key in word i of its block.
+ */
+static unsigned int _getCounter(const FilterBlock_t *block, size_t i,
+                                uint64_t hash)
+{
+    unsigned int shift
+        = FilterWordShift(hash, i, WORD_COUNTERS_LOG) * COUNTER_BITS;
+    return (block->words[i] >> shift) & COUNT_BLOOM_MAX;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file cuckoo_filter.c
+ *
+ * @brief
+ *  Structs and functions for cuckoo filters.
+ *
+ * @implements
+ *  cuckoo_filter.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "cuckoo_filter.h"
+#include "filter_block.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUCKET_SIZE (CUCKOO_FILTER_SLOTS * sizeof(uint16_t))
+#define MIN_BUCKETS (FILTER_ALIGN / BUCKET_SIZE)
+
+static void _hashKey(const CuckooFilter_t *filter, const void *key,
+                     uint16_t *fingerprint, size_t *i);
+static size_t _altIndex(size_t i, uint16_t fingerprint, size_t mask);
+static bool _addToBucket(uint16_t *bucket, uint16_t fingerprint);
+static bool _removeFromBucket(uint16_t *bucket, uint16_t fingerprint);
+static bool _isInBucket(const uint16_t *bucket, uint16_t fingerprint);
+static void _addFingerprint(CuckooFilter_t *filter, uint16_t fingerprint,
+                            size_t i);
+static uint64_t _nextRand(CuckooFilter_t *filter);
+
+CuckooFilter_t *CuckooFilterCreate(size_t key_count,
+                                   size_t (*hash_func)(const void *))
+{
+    assert(hash_func != NULL);
+
+    size_t needed = key_count / (CUCKOO_FILTER_SLOTS * CUCKOO_FILTER_LOAD) + 1;
+    size_t bucket_count = MIN_BUCKETS;
+    while (bucket_count < needed) {
+        bucket_count *= 2;
+    }
+    CuckooFilter_t *filter = malloc(sizeof(CuckooFilter_t));
+    if (filter == NULL) {
+        return NULL;
+    }
+    filter->buckets = aligned_alloc(FILTER_ALIGN, bucket_count * BUCKET_SIZE);
+    if (filter->buckets == NULL) {
+        free(filter);
+        return NULL;
+    }
+    memset(filter->buckets, 0, bucket_count * BUCKET_SIZE);
+    filter->mask = bucket_count - 1;
+    filter->count = 0;
+    filter->victim.is_used = false;
+    filter->rand_state = randomSeed() | 1;
+    filter->hash = hash_func;
+    return filter;
+}
+
+void CuckooFilterClear(CuckooFilter_t **p_filter)
+{
+    assert(p_filter != NULL);
+    assert(*p_filter != NULL);
+
+    free((*p_filter)->buckets);
+    free(*p_filter);
+    *p_filter = NULL;
+}
+
+bool CuckooFilterAdd(CuckooFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    if (filter->victim.is_used) {
+        return false;
+    }
+    uint16_t fingerprint;
+    size_t i;
+    _hashKey(filter, key, &fingerprint, &i);
+    filter->count += 1;
+    _addFingerprint(filter, fingerprint, i);
+    return true;
+}
+
+bool CuckooFilterRemove(CuckooFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    uint16_t fingerprint;
+    size_t i;
+    _hashKey(filter, key, &fingerprint, &i);
+    size_t alt_i = _altIndex(i, fingerprint, filter->mask);
+    if (filter->victim.is_used && filter->victim.fingerprint == fingerprint
+        && (filter->victim.i == i || filter->victim.i == alt_i)) {
+        filter->victim.is_used = false;
+        filter->count -= 1;
+        return true;
+    }
+    if (!_removeFromBucket(filter->buckets[i], fingerprint)
+        && !_removeFromBucket(filter->buckets[alt_i], fingerprint)) {
+        return false;
+    }
+    filter->count -= 1;
+    if (filter->victim.is_used) {
+        // the freed slot may be the room the victim was missing
+        filter->victim.is_used = false;
+        _addFingerprint(filter, filter->victim.fingerprint, filter->victim.i);
+    }
+    return true;
+}
+
+bool CuckooFilterMayContain(const CuckooFilter_t *filter, const void *key)
+{
+    assert(filter != NULL);
+
+    uint16_t fingerprint;
+    size_t i;
+    _hashKey(filter, key, &fingerprint, &i);
+    size_t alt_i = _altIndex(i, fingerprint, filter->mask);
+    if (filter->victim.is_used && filter->victim.fingerprint == fingerprint
+        && (filter->victim.i == i || filter->victim.i == alt_i)) {
+        return true;
+    }
+    return _isInBucket(filter->buckets[i], fingerprint)
+           || _isInBucket(filter->buckets[alt_i], fingerprint);
+}
+
+/**
+ * @brief
+ *  Gets the fingerprint of a key from the high bits of its mixed hash and
+ *  its first bucket from the low bits. Fingerprints are never 0.
+ */
+static void _hashKey(const CuckooFilter_t *filter, const void *key,
+                     uint16_t *fingerprint, size_t *i)
+{
+    uint64_t hash = FilterMix(filter->hash(key));
+    *fingerprint = hash >> 48;
+    if (*fingerprint == 0) {
+        *fingerprint = 1;
+    }
+    *i = hash & filter->mask;
+}
+
+/**
+ * @brief
+ *  Gets the other bucket of a fingerprint in bucket i. Applying it twice
+ *  gives back i.
+ */
+static size_t _altIndex(size_t i, uint16_t fingerprint, size_t mask)
+{
+    return (i ^ ((size_t)fingerprint * 0x5bd1e995U)) & mask;
+}
+
+/**
+ * @brief
+ *  Puts a fingerprint in the first empty slot of a bucket.
+ */
+static bool _addToBucket(uint16_t *bucket, uint16_t fingerprint)
+{
+    for (size_t s = 0; s < CUCKOO_FILTER_SLOTS; s++) {
+        if (bucket[s] == 0) {
+            bucket[s] = fingerprint;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *  Empties one slot of a bucket holding a fingerprint.
+ */
+static bool _removeFromBucket(uint16_t *bucket, uint16_t fingerprint)
+{
+    for (size_t s = 0; s < CUCKOO_FILTER_SLOTS; s++) {
+        if (bucket[s] == fingerprint) {
+            bucket[s] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *  Checks every slot of a bucket for a fingerprint without branching.
+ */
+static bool _isInBucket(const uint16_t *bucket, uint16_t fingerprint)
+{
+    bool is_in = false;
+    for (size_t s = 0; s < CUCKOO_FILTER_SLOTS; s++) {
+        is_in |= bucket[s] == fingerprint;
+    }
+    return is_in;
+}
+
+/**
+ * @brief
+ *  Adds a fingerprint to bucket i or its other bucket, kicking random
+ *  fingerprints to their other bucket when both are full. The fingerprint
+ *  left over when out of kicks becomes the victim.
+ */
+static void _addFingerprint(CuckooFilter_t *filter, uint16_t fingerprint,
+                            size_t i)
+{
+    size_t alt_i = _altIndex(i, fingerprint, filter->mask);
+    if (_addToBucket(filter->buckets[i], fingerprint)
+        || _addToBucket(filter->buckets[alt_i], fingerprint)) {
+        return;
+    }
+    if (_nextRand(filter) & 1) {
+        i = alt_i;
+    }
+    for (size_t kick = 0; kick < CUCKOO_FILTER_MAX_KICKS; kick++) {
+        uint16_t *slot
+            = &filter->buckets[i][_nextRand(filter) % CUCKOO_FILTER_SLOTS];
+        uint16_t tmp = *slot;
+        *slot = fingerprint;
+        fingerprint = tmp;
+        i = _altIndex(i, fingerprint, filter->mask);
+        if (_addToBucket(filter->buckets[i], fingerprint)) {
+            return;
+        }
+    }
+    filter->victim.fingerprint = fingerprint;
+    filter->victim.i = i;
+    filter->victim.is_used = true;
+}
+
+/**
+ * @brief
+ *  Advances the xorshift64 state of a filter.
+ */
+static uint64_t _nextRand(CuckooFilter_t *filter)
+{
+    filter->rand_state ^= filter->rand_state << 13;
+    filter->rand_state ^= filter->rand_state >> 7;
+    filter->rand_state ^= filter->rand_state << 17;
+    return filter->rand_state;
+}
@@ -0,0 +1,69 @@
+#include "blocked_bloom_filter.h"
+#include "hash_funcs.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 20000
+
+static bool _test_BlockedBloomFilterMayContain()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    BlockedBloomFilter_t *filter
+        = BlockedBloomFilterCreate(KEY_COUNT, 10, wyStrHash);
+    char key[16];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        BlockedBloomFilterAdd(filter, key);
+    }
+    size_t false_positives = 0;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!BlockedBloomFilterMayContain(filter, key)) {
+            is_ok = false;
+            printf("may contain: %s \t->\t res: false | ans: true\n", key);
+        }
+        snprintf(key, sizeof(key), "missing_%lu", i);
+        false_positives += BlockedBloomFilterMayContain(filter, key);
+    }
+    // about 1% with 10 bits per key
+    if (false_positives > KEY_COUNT * 3 / 100) {
+        is_ok = false;
+        printf("false positives: res: %lu | ans: <= %d\n", false_positives,
+               KEY_COUNT * 3 / 100);
+    }
+    BlockedBloomFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_BlockedBloomFilterEmpty()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    BlockedBloomFilter_t *filter = BlockedBloomFilterCreate(0, 10, wyStrHash);
+    char key[16];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (BlockedBloomFilterMayContain(filter, key)) {
+            is_ok = false;
+            printf("may contain: %s \t->\t res: true | ans: false\n", key);
+        }
+    }
+    BlockedBloomFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_BlockedBloomFilterMayContain();
+    is_ok &= _test_BlockedBloomFilterEmpty();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,90 @@
+#include "counting_bloom_filter.h"
+#include "hash_funcs.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 20000
+
+static bool _test_CountingBloomFilterAddRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    CountingBloomFilter_t *filter
+        = CountingBloomFilterCreate(KEY_COUNT, 10, wyStrHash);
+    char key[16];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        CountingBloomFilterAdd(filter, key);
+    }
+    // a key added twice stays after one removal
+    CountingBloomFilterAdd(filter, "key_1");
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!CountingBloomFilterRemove(filter, key)) {
+            is_ok = false;
+            printf("remove: %s \t->\t res: false | ans: true\n", key);
+        }
+    }
+    CountingBloomFilterRemove(filter, "key_1");
+    size_t false_positives = 0;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        bool res = CountingBloomFilterMayContain(filter, key);
+        if (i % 2 == 1 && !res) {
+            is_ok = false;
+            printf("may contain: %s \t->\t res: false | ans: true\n", key);
+        }
+        false_positives += i % 2 == 0 && res;
+        snprintf(key, sizeof(key), "missing_%lu", i);
+        false_positives += CountingBloomFilterMayContain(filter, key);
+    }
+    // the removed keys are as unlikely to be found as missing ones
+    if (false_positives > KEY_COUNT * 3 / 2 / 100) {
+        is_ok = false;
+        printf("false positives: res: %lu | ans: <= %d\n", false_positives,
+               KEY_COUNT * 3 / 2 / 100);
+    }
+    CountingBloomFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_CountingBloomFilterRemoveMissing()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    CountingBloomFilter_t *filter
+        = CountingBloomFilterCreate(KEY_COUNT, 10, wyStrHash);
+    if (CountingBloomFilterRemove(filter, "key_0")) {
+        is_ok = false;
+        printf("remove missing: res: true | ans: false\n");
+    }
+    // counters that saturate are never decremented, so keys sharing them
+    // are kept after the others are removed
+    for (size_t i = 0; i < 2 * COUNT_BLOOM_MAX; i++) {
+        CountingBloomFilterAdd(filter, "key_0");
+    }
+    for (size_t i = 0; i < 2 * COUNT_BLOOM_MAX; i++) {
+        CountingBloomFilterRemove(filter, "key_0");
+    }
+    if (!CountingBloomFilterMayContain(filter, "key_0")) {
+        is_ok = false;
+        printf("saturated: res: false | ans: true\n");
+    }
+    CountingBloomFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_CountingBloomFilterAddRemove();
+    is_ok &= _test_CountingBloomFilterRemoveMissing();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,105 @@
+#include "cuckoo_filter.h"
+#include "hash_funcs.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 20000
+
+static bool _test_CuckooFilterAddRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    CuckooFilter_t *filter = CuckooFilterCreate(KEY_COUNT, wyStrHash);
+    char key[16];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!CuckooFilterAdd(filter, key)) {
+            is_ok = false;
+            printf("add: %s \t->\t res: false | ans: true\n", key);
+        }
+    }
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!CuckooFilterRemove(filter, key)) {
+            is_ok = false;
+            printf("remove: %s \t->\t res: false | ans: true\n", key);
+        }
+    }
+    size_t false_positives = 0;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        bool res = CuckooFilterMayContain(filter, key);
+        if (i % 2 == 1 && !res) {
+            is_ok = false;
+            printf("may contain: %s \t->\t res: false | ans: true\n", key);
+        }
+        false_positives += i % 2 == 0 && res;
+        snprintf(key, sizeof(key), "missing_%lu", i);
+        false_positives += CuckooFilterMayContain(filter, key);
+    }
+    // about 0.01% with 16 bit fingerprints
+    if (false_positives > 10 || filter->count != KEY_COUNT / 2) {
+        is_ok = false;
+        printf("false positives: res: %lu | ans: <= 10\n", false_positives);
+        printf("count: res: %lu | ans: %d\n", filter->count, KEY_COUNT / 2);
+    }
+    CuckooFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_CuckooFilterFull()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    CuckooFilter_t *filter = CuckooFilterCreate(100, wyStrHash);
+    char key[16];
+    size_t added = 0;
+    for (; added < KEY_COUNT; added++) {
+        snprintf(key, sizeof(key), "key_%lu", added);
+        if (!CuckooFilterAdd(filter, key)) {
+            break;
+        }
+    }
+    size_t slot_count = (filter->mask + 1) * CUCKOO_FILTER_SLOTS;
+    if (added * 100 < slot_count * 90 || added > slot_count + 1) {
+        is_ok = false;
+        printf("added: res: %lu | ans: %lu * 0.9 to %lu\n", added,
+               slot_count, slot_count + 1);
+    }
+    // the key that didn't fit is the victim, still found
+    for (size_t i = 0; i < added; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!CuckooFilterMayContain(filter, key)) {
+            is_ok = false;
+            printf("may contain: %s \t->\t res: false | ans: true\n", key);
+        }
+    }
+    for (size_t i = 0; i < added; i++) {
+        snprintf(key, sizeof(key), "key_%lu", i);
+        if (!CuckooFilterRemove(filter, key)) {
+            is_ok = false;
+            printf("remove: %s \t->\t res: false | ans: true\n", key);
+        }
+    }
+    if (filter->count != 0 || filter->victim.is_used) {
+        is_ok = false;
+        printf("count: res: %lu | ans: 0\n", filter->count);
+    }
+    CuckooFilterClear(&filter);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_CuckooFilterAddRemove();
+    is_ok &= _test_CuckooFilterFull();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file _robinhood_slots.h
+ *
+ * @brief
+ *  Probe sequence functions shared by the robinhood hashtable and hashset.
+ *  The slots of either are an array of some slot type next to a byte array
+ *  of probe sequence lengths + 1, 0 for an empty slot; defRobinSlots
+ *  generates the functions moving slots of a type around.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef _ROBINHOOD_SLOTS_H
+#define _ROBINHOOD_SLOTS_H
+
+#include "hashtable_index.h"
+#include "robinhood_hashtable.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief
+ *  Checks whether a slot with the home index i can be placed without any
+ *  probe sequence growing past max_psl.
+ */
+static inline bool robinSlotsCanAdd(const unsigned char *psls, size_t i,
+                                    size_t max_count, HTIndexing_t indexing,
+                                    unsigned char max_psl)
+{
+    unsigned char psl = 1;
+    for (; psls[i] != 0; i = HTIndexingNext(indexing, i, max_count)) {
+        if (psl > psls[i]) {
+            psl = psls[i];
+        }
+        if (psl > max_psl) {
+            return false;
+        }
+        psl += 1;
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *  Gets the count of used slots at which adds rehash, max_load * max_count
+ *  rounded up so an add only compares integers; max_count if max_load is 0.
+ */
+static inline size_t robinSlotsLimit(float max_load, size_t max_count)
+{
+    double limit = (double)max_load * max_count;
+    size_t int_limit = (size_t)limit;
+    if ((double)int_limit < limit) {
+        int_limit += 1;
+    }
+    if (max_load == 0 || int_limit > max_count) {
+        int_limit = max_count;
+    }
+    return int_limit;
+}
+
+/**
+ * @brief
+ *  Gets the slot count an add grows to, twice the current one, or 0 if the
+ *  new slot array's size would overflow.
+ */
+static inline size_t robinSlotsGrownCount(size_t max_count, size_t slot_size)
+{
+    if (max_count > SIZE_MAX / 2 / slot_size) {
+        return 0;
+    }
+    return 2 * max_count;
+}
+
+/**
+ * @brief
+ *  Checks whether at least 1/8 of the slots are used (used * 8 >= max,
+ *  without the multiplication overflowing); below that, growing won't help
+ *  keys that collide on their own.
+ */
+static inline bool robinSlotsIsWorthGrowing(size_t used, size_t max_count)
+{
+    return max_count == 0 || used > (max_count - 1) / 8;
+}
+
+/**
+ * @brief
+ *  Generates the functions moving slots of slot_type, named with the given
+ *  prefix: @n
+ *  bool nameAdd(slots, psls, new_slot, i, max_count, indexing) places a slot
+ *  from its home index i, displacing richer slots along the way; false if a
+ *  probe sequence would exceed ROBIN_HT_MAX_PSL, with the slots left
+ *  incomplete. @n
+ *  void nameRemove(slots, psls, i, max_count, indexing) empties slot i,
+ *  shifting the rest of its cluster back by one. @n
+ *  size_t nameRemoveIf(slots, psls, max_count, indexing, take, arg) empties
+ *  every slot take returns true for in one sweep, shifting the slots left
+ *  back over the gaps, and returns how many it emptied. take gets a pointer
+ *  to the slot and arg, and frees whatever it needs to. @n
+ */
+#define defRobinSlots(name, slot_type)                                         \
+    static inline bool name##Add(slot_type *slots, unsigned char *psls,        \
+                                 slot_type new_slot, size_t i,                 \
+                                 size_t max_count, HTIndexing_t indexing)      \
+    {                                                                          \
+        unsigned char psl = 1;                                                 \
+        for (; psls[i] != 0; i = HTIndexingNext(indexing, i, max_count)) {     \
+            if (psl > psls[i]) {                                               \
+                slot_type temp = slots[i];                                     \
+                unsigned char temp_psl = psls[i];                              \
+                slots[i] = new_slot;                                           \
+                psls[i] = psl;                                                 \
+                new_slot = temp;                                               \
+                psl = temp_psl;                                                \
+            }                                                                  \
+            if (psl > ROBIN_HT_MAX_PSL) {                                      \
+                return false;                                                  \
+            }                                                                  \
+            psl += 1;                                                          \
+        }                                                                      \
+        slots[i] = new_slot;                                                   \
+        psls[i] = psl;                                                         \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline void name##Remove(slot_type *slots, unsigned char *psls,     \
+                                    size_t i, size_t max_count,                \
+                                    HTIndexing_t indexing)                     \
+    {                                                                          \
+        size_t prev_i = i;                                                     \
+        i = HTIndexingNext(indexing, i, max_count);                            \
+        while (psls[i] > 1) {                                                  \
+            slots[prev_i] = slots[i];                                          \
+            psls[prev_i] = psls[i] - 1;                                        \
+            prev_i = i;                                                        \
+            i = HTIndexingNext(indexing, i, max_count);                        \
+        }                                                                      \
+        psls[prev_i] = 0;                                                      \
+    }                                                                          \
+                                                                               \
+    /* shifts slot i back over up to gap empty slots before it, no further */  \
+    /* than its home, and returns how far it moved */                          \
+    static inline size_t name##Shift(slot_type *slots, unsigned char *psls,    \
+                                     size_t i, size_t gap, size_t max_count)   \
+    {                                                                          \
+        size_t shift = psls[i] - 1;                                            \
+        if (gap < shift) {                                                     \
+            shift = gap;                                                       \
+        }                                                                      \
+        if (shift > 0) {                                                       \
+            size_t new_i = (i >= shift) ? i - shift : i + max_count - shift;   \
+            slots[new_i] = slots[i];                                           \
+            psls[new_i] = psls[i] - shift;                                     \
+            psls[i] = 0;                                                       \
+        }                                                                      \
+        return shift;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline size_t name##RemoveIf(slot_type *slots, unsigned char *psls, \
+                                        size_t max_count,                      \
+                                        HTIndexing_t indexing,                 \
+                                        bool (*take)(slot_type *, void *),     \
+                                        void *arg)                             \
+    {                                                                          \
+        size_t removed = 0;                                                    \
+        size_t gap = 0; /* empty slots right before i to move to */            \
+        for (size_t i = 0; i < max_count; i++) {                               \
+            if (psls[i] == 0) {                                                \
+                gap = 0;                                                       \
+            } else if (take(&slots[i], arg)) {                                 \
+                psls[i] = 0;                                                   \
+                gap += 1;                                                      \
+                removed += 1;                                                  \
+            } else {                                                           \
+                gap = name##Shift(slots, psls, i, gap, max_count);             \
+            }                                                                  \
+        }                                                                      \
+        /* a cluster wrapping past the end can still shift into the gap */     \
+        for (size_t i = 0; gap > 0 && psls[i] > 1;                             \
+             i = HTIndexingNext(indexing, i, max_count)) {                     \
+            gap = name##Shift(slots, psls, i, gap, max_count);                 \
+        }                                                                      \
+        return removed;                                                        \
+    }
+
+#endif
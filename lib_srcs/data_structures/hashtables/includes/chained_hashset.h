@@ -0,0 +1,186 @@
+/**
+ * @file chained_hashset.h
+ *
+ * @brief
+ *  Structs and functions for chained hashsets. Each bucket is the head of a
+ *  chain of nodes holding only a key pointer, for membership tests and
+ *  deduplication; a node takes 16 bytes instead of the 24 of a chained
+ *  hashtable, and a bucket 8 instead of a whole list.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef CHAINED_HASHSET_H
+#define CHAINED_HASHSET_H
+
+#include "hashtable_index.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct ChainHSNode {    // node in a chained hashset bucket
+    void *key;                  // Pointer to the key
+    struct ChainHSNode *next;   // next node in the bucket
+} ChainHSNode_t;
+
+typedef struct ChainHashSet {
+    ChainHSNode_t **buckets; // array of the first node of each bucket
+    size_t length;           // length of the bucket array
+    size_t count;            // number of keys in the set
+    float max_load; // load (count / length) to double the buckets at;
+                    // 0 to disable growing
+    float min_load; // load to halve the buckets at after a removal; 0 to
+                    // disable shrinking, should be below half of max_load
+    HTIndexing_t indexing; // how hashes are reduced to bucket indices
+    size_t (*hash)(const void *);
+    /**
+     *  The compare function must operate as follows: @n
+     *  1) Returns int < 0 if key_1 should come before key_2 @n
+     *  2) Returns int >= 0 if key_1 should come after key_2 @n
+     */
+    int (*comp_key)(const void *, const void *);
+} ChainHashSet_t;
+
+/**
+ * @brief
+ *  Creates a chained hashset with a specific initial amount of buckets.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] bucket_count  initial number of buckets
+ * @param[in] max_load_prop load to grow at; 0 if no growing wanted
+ * @param[in] min_load_prop load to shrink at, below half of max_load_prop;
+ *                          0 if no shrinking wanted
+ * @param[in] indexing      how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
+ * @param[in] hash_func     function to hash keys
+ * @param[in] comp_key      function to compare the keys
+ *
+ * @return New chained hashset. NULL if unable to allocate memory.
+ */
+extern ChainHashSet_t *
+ChainHashSetCreate(size_t bucket_count, float max_load_prop,
+                   float min_load_prop, HTIndexing_t indexing,
+                   size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a chained hashset and frees it's keys if provided with a function
+ *  do so.
+ *
+ * @param[in,out] p_set     chained hashset to delete
+ * @param[in]     free_key  function to free keys; NULL if not needed
+ */
+extern void ChainHashSetClear(ChainHashSet_t **p_set,
+                              void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Adds a key to a chained hashset if it isn't in it already. Doubles the
+ *  number of buckets if the max load has been reached, the key is still
+ *  added if that fails.
+ *
+ * @param[in,out] set       chained hashset to add to
+ * @param[in]     key       key to add
+ *
+ * @return
+ *   1 : added successfully @n
+ *   0 : the key is already in the set @n
+ *  -1 : unable to allocate memory @n
+ */
+extern int ChainHashSetAdd(ChainHashSet_t *set, void *key);
+
+/**
+ * @brief
+ *  Removes a key from a chained hashset and frees it if provided with a
+ *  function do so. Halves the number of buckets if the load falls below the
+ *  min load.
+ *
+ * @param[in,out] set       chained hashset to remove from
+ * @param[in]     key       key to remove
+ * @param[in]     free_key  function to free keys; NULL if not needed
+ *
+ * @return
+ *  true  : removed successfully @n
+ *  false : the key isn't in the set @n
+ */
+extern bool ChainHashSetRemove(ChainHashSet_t *set, const void *key,
+                               void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Checks if a key is in a chained hashset.
+ *
+ * @param[in] set           chained hashset to search
+ * @param[in] key           key to find
+ *
+ * @return
+ *  true  : the key is in the set @n
+ *  false : the key isn't in the set @n
+ */
+extern bool ChainHashSetContains(const ChainHashSet_t *set, const void *key);
+
+/**
+ * @brief
+ *  Rehashes a chained hashset into a new number of buckets, relinking the
+ *  nodes rather than reallocating them.
+ *
+ * @param[in,out] set       chained hashset to rehash
+ * @param[in]     new_count new number of buckets
+ *
+ * @return
+ *  true  : rehashed successfully @n
+ *  false : unable to allocate memory @n
+ */
+extern bool ChainHashSetRehash(ChainHashSet_t *set, size_t new_count);
+
+/**
+ * @brief
+ *  Adds every key of another chained hashset to a chained hashset, growing
+ *  it once up front. The keys are shared, not copied.
+ *
+ * @param[in,out] set       chained hashset to add to
+ * @param[in]     other     chained hashset to add the keys of
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : unable to allocate memory @n
+ */
+extern bool ChainHashSetUnion(ChainHashSet_t *set, const ChainHashSet_t *other);
+
+/**
+ * @brief
+ *  Removes every key of a chained hashset that isn't in another chained
+ *  hashset and frees them if provided with a function do so, shrinking the
+ *  buckets once afterwards if needed.
+ *
+ * @param[in,out] set       chained hashset to remove from
+ * @param[in]     other     chained hashset of the keys to keep
+ * @param[in]     free_key  function to free keys; NULL if not needed
+ *
+ * @return Number of keys removed.
+ */
+extern size_t ChainHashSetIntersect(ChainHashSet_t *set,
+                                    const ChainHashSet_t *other,
+                                    void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Removes every key of a chained hashset that is in another chained hashset
+ *  and frees them if provided with a function do so, shrinking the buckets
+ *  once afterwards if needed.
+ *
+ * @param[in,out] set       chained hashset to remove from
+ * @param[in]     other     chained hashset of the keys to remove
+ * @param[in]     free_key  function to free keys; NULL if not needed
+ *
+ * @return Number of keys removed.
+ */
+extern size_t ChainHashSetDifference(ChainHashSet_t *set,
+                                     const ChainHashSet_t *other,
+                                     void (*free_key)(void *));
+#endif
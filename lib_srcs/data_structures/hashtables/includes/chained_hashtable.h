@@ -11,34 +11,90 @@
 #ifndef CHAINED_HASHTABLE_H
 #define CHAINED_HASHTABLE_H
 
+#include "hashtable_index.h"
+#include "hashtable_stats.h"
 #include "linked_list_kvp.h"
 #include <stddef.h>
 
 typedef struct ChainHashTable {
     LListKVP_t *buckets; // array of linked list buckets
     size_t length;            // length of the bucket array
+    size_t count;             // number of key-value pairs in the table
+    float max_load; // load (count / length) to double the buckets at;
+                    // 0 to disable growing
+    float min_load; // load to halve the buckets at after a removal; 0 to
+                    // disable shrinking, should be below half of max_load
+    HTIndexing_t indexing;    // how hashes are reduced to bucket indices
     size_t (*hash)(const void *);
+    size_t (*seeded_hash)(const void *, size_t); // used instead of hash when
+                                                 // set, called with seed
+    size_t seed; // random seed of the table, set by the seeded create
+    HTRehashes_t rehashes; // rehashes done so far and time spent on them
+#ifdef HT_STATS
+    HTCounters_t counters; // work done by finds; removes aren't counted
+#endif
 } ChainHashTable_t;
 
+typedef struct ChainHTIter { // position of an iterator over a chained hashtable
+    size_t bucket;           // next bucket to look at
+    LListKVPNode_t *node;    // current node
+    void *key;               // key of the current entry
+    void *data;              // data of the current entry
+} ChainHTIter_t;
+
 /**
  * @brief
- *  Creates a chained hashtable with a specific amount of buckets.
+ *  Creates a chained hashtable with a specific initial amount of buckets.
  *
  * @note
  *  If provided the compare function must operate as follows: @n
  *  1) Returns int < 0 if key_1 should come before key_2 @n
  *  2) Returns int >= 0 if key_1 should come after key_2 @n
  *
- * @param[in] bucket_count  number of buckets
+ * @param[in] bucket_count  initial number of buckets
+ * @param[in] max_load_prop load to grow at; 0 if no growing wanted
+ * @param[in] min_load_prop load to shrink at, below half of max_load_prop;
+ *                          0 if no shrinking wanted
+ * @param[in] indexing      how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
  * @param[in] hash_func     function to hash keys
  * @param[in] comp_key      function to compare the keys
  *
  * @return New chained hashtable. NULL if unable to allocate memory.
  */
 extern ChainHashTable_t *
-ChainHashTableCreate(size_t bucket_count, size_t (*hash_func)(const void *),
+ChainHashTableCreate(size_t bucket_count, float max_load_prop,
+                     float min_load_prop, HTIndexing_t indexing,
+                     size_t (*hash_func)(const void *),
                      int (*comp_key)(const void *, const void *));
 
+/**
+ * @brief
+ *  Creates a chained hashtable that hashes its keys with a random seed of
+ *  its own, so that which keys share a bucket can't be predicted from
+ *  outside the process.
+ *
+ * @note
+ *  For keys from untrusted input use a keyed hash such as sipStrHash; a
+ *  fast seeded hash such as wyStrHashSeeded only spreads the load.
+ *
+ * @param[in] bucket_count  initial number of buckets
+ * @param[in] max_load_prop load to grow at; 0 if no growing wanted
+ * @param[in] min_load_prop load to shrink at, below half of max_load_prop;
+ *                          0 if no shrinking wanted
+ * @param[in] indexing      how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
+ * @param[in] hash_func     function to hash keys with a seed
+ * @param[in] comp_key      function to compare the keys
+ *
+ * @return New chained hashtable. NULL if unable to allocate memory.
+ */
+extern ChainHashTable_t *
+ChainHashTableCreateSeeded(size_t bucket_count, float max_load_prop,
+                           float min_load_prop, HTIndexing_t indexing,
+                           size_t (*hash_func)(const void *, size_t),
+                           int (*comp_key)(const void *, const void *));
+
 /**
  * @brief
  *  Frees the entire chained hashtable and its data if given a function to free
@@ -56,6 +112,8 @@ extern void ChainHashTableClear(ChainHashTable_t **p_table,
  * @brief
  *  Adds a new key-value pair to a chained hash table, with the option to place
  *  it in a specific position in the bucket using a data compare function.
+ *  Doubles the number of buckets if the max load has been reached, the pair
+ *  is still added if that fails.
  *
  * @param[in,out] table     chained hash table to add to
  * @param[in]     key       key of the new data
@@ -70,7 +128,8 @@ extern int ChainHashTableAdd(ChainHashTable_t *table, void *key,
 
 /**
  * @brief
- *  Removes an key-value pair from a chained hash table
+ *  Removes an key-value pair from a chained hash table. Halves the number of
+ *  buckets if the load has dropped below the min load.
  *
  * @param[in,out] table     chained hash table to remove from
  * @param[in]     key       key of the data to remove
@@ -93,6 +152,21 @@ extern void *ChainHashTableRemove(ChainHashTable_t *table, void *key,
  */
 extern void *ChainHashTableFind(ChainHashTable_t *table, const void *key);
 
+/**
+ * @brief
+ *  Gets the first instance data of many keys in a chained hashtable. The keys
+ *  are hashed HT_FIND_BATCH at a time, then their buckets and the first node
+ *  of each are prefetched before any chain is searched, so the cache misses
+ *  of a batch overlap.
+ *
+ * @param[in]  table        chained hashtable to search
+ * @param[in]  keys         keys of the data
+ * @param[in]  key_count    number of keys
+ * @param[out] results      data of each key, NULL if not found
+ */
+extern void ChainHashTableFindBatch(ChainHashTable_t *table, void **keys,
+                                    size_t key_count, void **results);
+
 /**
  * @brief
  *  Gets all the data (in the form a dynamic pointer array) with a matching key
@@ -132,6 +206,59 @@ extern int ChainHashTableCountRepeats(ChainHashTable_t *table,
 extern void ChainHashTableTraverse(ChainHashTable_t *table,
                                    void (*func)(void *, void *));
 
+/**
+ * @brief
+ *  Starts an iterator over a chained hashtable. Nothing is allocated; the
+ *  iterator walks the buckets in order. The table must not change while it
+ *  is iterated.
+ *
+ * @param[in]  table        hashtable to iterate over
+ * @param[out] iter         iterator to start
+ */
+extern void ChainHashTableIterBegin(const ChainHashTable_t *table,
+                                    ChainHTIter_t *iter);
+
+/**
+ * @brief
+ *  Moves an iterator to the next entry of a chained hashtable, setting it's
+ *  key and data.
+ *
+ * @param[in]     table     hashtable being iterated over
+ * @param[in,out] iter      iterator to move
+ *
+ * @return
+ *  true  : moved to the next entry @n
+ *  false : reached the end of the table @n
+ */
+extern bool ChainHashTableIterNext(const ChainHashTable_t *table,
+                                   ChainHTIter_t *iter);
+
+/**
+ * @brief
+ *  Visits the entries of at least step buckets of a chained hashtable,
+ *  starting at a cursor, so a table can be walked a bit at a time while it
+ *  keeps being changed. Start with cursor 0 and pass back the cursor
+ *  returned until it is 0 again. @n
+ *  With HT_INDEX_MASK the cursor is advanced with reversed bits, so every
+ *  entry present for the whole scan is visited even if the table grows or
+ *  shrinks between calls, though some may be visited twice after shrinking.
+ *  With other indexing it only holds if the table isn't rehashed during the
+ *  scan.
+ *
+ * @param[in,out] table     hashtable to scan
+ * @param[in]     cursor    cursor returned by the last call; 0 to start
+ * @param[in]     step      number of buckets to visit at least
+ * @param[in]     func      function called with the key, data and arg of each
+ *                          entry visited; must not change the table
+ * @param[in]     arg       passed to func; NULL if not needed
+ *
+ * @return Cursor to continue from, 0 once the scan is complete.
+ */
+extern size_t ChainHashTableScan(ChainHashTable_t *table, size_t cursor,
+                                 size_t step,
+                                 void (*func)(void *, void *, void *),
+                                 void *arg);
+
 /**
  * @brief
  *  Gets the length of the bucket pointed to by the given key. Doesn't check
@@ -144,4 +271,30 @@ extern void ChainHashTableTraverse(ChainHashTable_t *table,
  */
 extern int ChainHashTableChainLength(ChainHashTable_t *table,
                                      const void *key);
+
+/**
+ * @brief
+ *  Rehashes a chained hashtable by relinking its existing nodes into a new
+ *  array of buckets, without reallocating any of them.
+ *
+ * @param[in,out] table         chained hashtable to rehash
+ * @param[in]     new_count     new number of buckets, rounded up to a power
+ *                              of 2 for HT_INDEX_MASK
+ *
+ * @return
+ *  true  : rehashed successfully @n
+ *  false : unable to allocate memory @n
+ */
+extern bool ChainHashTableRehash(ChainHashTable_t *table, size_t new_count);
+
+/**
+ * @brief
+ *  Gets the load, chain lengths and rehash record of a chained hashtable.
+ *  The histogram holds the buckets by chain length.
+ *
+ * @param[in]  table        chained hashtable to inspect
+ * @param[out] stats        statistics of the table
+ */
+extern void ChainHashTableStats(const ChainHashTable_t *table,
+                                HTStats_t *stats);
 #endif
\ No newline at end of file
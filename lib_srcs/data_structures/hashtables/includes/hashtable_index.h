@@ -0,0 +1,145 @@
+/**
+ * @file hashtable_index.h
+ *
+ * @brief
+ *  Policies and inline functions for reducing hashes to bucket indices,
+ *  shared by the hashtables.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef HASHTABLE_INDEX_H
+#define HASHTABLE_INDEX_H
+
+#include "hash_funcs.h"
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HT_FIND_BATCH 16 // keys hashed and prefetched together by a batch find
+
+#if defined(__GNUC__)
+#define HT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define HT_PREFETCH(addr) ((void)(addr))
+#endif
+
+typedef enum HTIndexing { // how a hash is reduced to a bucket index
+    HT_INDEX_MOD,         // hash % count; any bucket count
+    HT_INDEX_MASK,        // mixed hash & (count - 1); bucket count is rounded
+                          // up to a power of 2
+    HT_INDEX_MULSHIFT,    // (mixed hash * count) >> bits of size_t (Lemire's
+                          // reduction); any bucket count
+} HTIndexing_t;
+
+/**
+ * @brief
+ *  Rounds a bucket count to one usable by the indexing policy.
+ *
+ * @param[in] indexing  indexing policy
+ * @param[in] count     requested number of buckets
+ *
+ * @return Number of buckets to allocate.
+ */
+static inline size_t HTIndexingRound(HTIndexing_t indexing, size_t count)
+{
+    if (indexing != HT_INDEX_MASK) {
+        return count;
+    }
+    size_t rounded = 1;
+    while (rounded < count) {
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+/**
+ * @brief
+ *  Reduces a hash to a bucket index. The MASK and MULSHIFT policies mix the
+ *  hash first, as they only look at its low or high bits respectively.
+ *
+ * @param[in] indexing  indexing policy
+ * @param[in] hash      hash of the key
+ * @param[in] count     number of buckets, as returned by HTIndexingRound
+ *
+ * @return Bucket index in [0, count).
+ */
+static inline size_t HTIndexingReduce(HTIndexing_t indexing, size_t hash,
+                                      size_t count)
+{
+    switch (indexing) {
+    case HT_INDEX_MASK:
+        return mixHash(hash) & (count - 1);
+    case HT_INDEX_MULSHIFT:
+#if SIZE_MAX <= UINT32_MAX
+        return ((uint64_t)mixHash(hash) * count) >> 32;
+#elif defined(__SIZEOF_INT128__)
+        return ((unsigned __int128)mixHash(hash) * count) >> 64;
+#else
+        return mixHash(hash) % count;
+#endif
+    default:
+        return hash % count;
+    }
+}
+
+/**
+ * @brief
+ *  Gets the next bucket index in a linear probe, wrapping back to 0 without
+ *  a division.
+ *
+ * @param[in] indexing  indexing policy
+ * @param[in] i         current bucket index
+ * @param[in] count     number of buckets, as returned by HTIndexingRound
+ *
+ * @return Next bucket index.
+ */
+static inline size_t HTIndexingNext(HTIndexing_t indexing, size_t i,
+                                    size_t count)
+{
+    if (indexing == HT_INDEX_MASK) {
+        return (i + 1) & (count - 1);
+    }
+    return (i + 1 == count) ? 0 : i + 1;
+}
+
+/**
+ * @brief
+ *  Reverses the order of the bits of a size_t.
+ *
+ * @param[in] bits      bits to reverse
+ *
+ * @return Reversed bits.
+ */
+static inline size_t HTReverseBits(size_t bits)
+{
+    size_t width = sizeof(size_t) * CHAR_BIT;
+    size_t mask = ~(size_t)0;
+    while ((width >>= 1) > 0) {
+        mask ^= mask << width;
+        bits = ((bits >> width) & mask) | ((bits << width) & ~mask);
+    }
+    return bits;
+}
+
+/**
+ * @brief
+ *  Advances a scan cursor over HT_INDEX_MASK buckets by incrementing its
+ *  masked bits from the highest down. Every bucket of a table twice or half
+ *  the size that is split from or merged into a visited bucket then comes
+ *  before the cursor too, so a scan stays valid across a rehash.
+ *
+ * @param[in] cursor    cursor of the bucket just visited
+ * @param[in] mask      number of buckets - 1
+ *
+ * @return Cursor of the next bucket, 0 once every bucket has been visited.
+ */
+static inline size_t HTScanNext(size_t cursor, size_t mask)
+{
+    cursor |= ~mask;
+    cursor = HTReverseBits(cursor);
+    cursor += 1;
+    return HTReverseBits(cursor);
+}
+#endif
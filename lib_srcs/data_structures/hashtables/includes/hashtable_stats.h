@@ -0,0 +1,92 @@
+/**
+ * @file hashtable_stats.h
+ *
+ * @brief
+ *  Structs and inline functions for reporting the shape and cost of the
+ *  hashtables. The per-operation counters are only kept when the library is
+ *  built with HT_STATS defined (the HASHTABLE_STATS CMake option). They are
+ *  relaxed atomics, so finds sharing a table under a read lock, as in a
+ *  sharded hashtable, can count at the same time.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef HASHTABLE_STATS_H
+#define HASHTABLE_STATS_H
+
+#include <stddef.h>
+#include <time.h>
+
+#define HT_STATS_BINS 32 // bins of a histogram; the last also counts
+                         // everything past it
+
+#ifdef HT_STATS
+#include <stdatomic.h>
+#define HT_COUNT(table, counter, n)                                            \
+    atomic_fetch_add_explicit(&(table)->counters.counter, (n),                 \
+                              memory_order_relaxed)
+typedef atomic_size_t HTCount_t;
+#else
+// still uses table, so helpers taking it only for the counters don't warn
+#define HT_COUNT(table, counter, n) ((void)(table))
+typedef size_t HTCount_t;
+#endif
+
+typedef struct HTCounters { // counters of the work done by lookups
+    HTCount_t lookups;      // keys searched for by finds and removes
+    HTCount_t probes;       // buckets or nodes looked at by those lookups
+    HTCount_t compares;     // calls to the compare function by those lookups
+} HTCounters_t;
+
+typedef struct HTRehashes { // record of the rehashes of a hashtable
+    size_t count;           // rehashes done, including incremental ones
+    double secs;            // wall time spent rehashing
+} HTRehashes_t;
+
+typedef struct HTStats { // snapshot of a hashtable's shape and cost
+    size_t entries;
+    size_t buckets;
+    double load;         // entries per bucket
+    size_t max_probe;    // most buckets or nodes a successful find looks at
+    double mean_probe;   // mean of the same over all entries
+    /**
+     *  Robinhood: entries by probe sequence length, 0 for an entry in its
+     *  home bucket. @n
+     *  Chained: buckets by chain length. @n
+     */
+    size_t histogram[HT_STATS_BINS];
+    HTRehashes_t rehashes;
+    HTCounters_t counters; // all 0 unless built with HT_STATS
+} HTStats_t;
+
+/**
+ * @brief
+ *  Gets the current wall time in seconds, for timing rehashes.
+ *
+ * @return Seconds since an arbitrary point.
+ */
+static inline double HTStatsNow(void)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief
+ *  Adds a count to a bin of a histogram, putting anything past the last bin
+ *  in the last bin.
+ *
+ * @param[in,out] histogram     histogram to add to
+ * @param[in]     bin           bin to add to
+ * @param[in]     count         amount to add
+ */
+static inline void HTStatsAddBin(size_t *histogram, size_t bin, size_t count)
+{
+    if (bin >= HT_STATS_BINS) {
+        bin = HT_STATS_BINS - 1;
+    }
+    histogram[bin] += count;
+}
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file minimal_perfect_hash.h
+ *
+ * @brief
+ *  Structs and functions for minimal perfect hash functions and read-only
+ *  maps built on them, for static sets of keys. The hash is built BBHash
+ *  style: each level is a bit array about gamma times the size of the keys
+ *  still left, where a key whose bucket no other key lands in sets its bit
+ *  and the keys that collide are left for the next level. The index of a key
+ *  is the number of set bits before its own, so the n keys map onto 0 to
+ *  n - 1 with no gaps, at a little over 3 bits per key with a gamma of 1.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef MINIMAL_PERFECT_HASH_H
+#define MINIMAL_PERFECT_HASH_H
+
+#include "pointer_array.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define MIN_PERF_HASH_MAX_LEVELS 64 // levels tried before the keys that still
+                                    // collide are taken to be duplicates
+#define MIN_PERF_HASH_RANK_WORDS 8  // 64 bit words per stored rank
+
+typedef struct MinPerfHash { // minimal perfect hash function
+    uint64_t *bits;          // bit arrays of every level, one after another
+    uint64_t *ranks; // set bits before every MIN_PERF_HASH_RANK_WORDS words
+    size_t level_count;
+    size_t level_offsets[MIN_PERF_HASH_MAX_LEVELS + 1]; // first bit of each
+                                                        // level, then the end
+    size_t count; // number of keys
+    size_t (*hash)(const void *, size_t); // called with the level as seed
+} MinPerfHash_t;
+
+typedef struct MinPerfHashMap { // read-only map on a minimal perfect hash
+    MinPerfHash_t *hash;
+    void **keys; // Dynamic array of the keys, at the index of their hash
+    void **data; // Dynamic array of the data, at the same indices
+    /**
+     *  The compare function must operate as follows: @n
+     *  1) Returns int < 0 if key_1 should come before key_2 @n
+     *  2) Returns int >= 0 if key_1 should come after key_2 @n
+     */
+    int (*comp_key)(const void *, const void *);
+} MinPerfHashMap_t;
+
+/**
+ * @brief
+ *  Builds a minimal perfect hash function for a set of keys.
+ *
+ * @param[in] keys          distinct keys to hash
+ * @param[in] gamma         size of each level relative to the keys left for
+ *                          it, at least 1; larger builds and finds faster
+ *                          but uses more bits per key
+ * @param[in] hash_func     function to hash keys with a seed, such as
+ *                          wyStrHashSeeded
+ *
+ * @return
+ *  Pointer to the new hash function, NULL if unable to allocate memory or
+ *  the keys hold a duplicate.
+ */
+extern MinPerfHash_t *MinPerfHashCreate(const PointerArray_t *keys,
+                                        float gamma,
+                                        size_t (*hash_func)(const void *,
+                                                            size_t));
+
+/**
+ * @brief
+ *  Deletes a minimal perfect hash function.
+ *
+ * @param[in,out] p_hash        hash function to delete
+ */
+extern void MinPerfHashClear(MinPerfHash_t **p_hash);
+
+/**
+ * @brief
+ *  Gets the index of a key with a minimal perfect hash function. Each key
+ *  the function was built with gets a different index from 0 to count - 1;
+ *  other keys get any index or none.
+ *
+ * @param[in] hash          hash function to use
+ * @param[in] key           key to get the index of
+ *
+ * @return Index of the key, SIZE_MAX if it surely isn't one of the keys.
+ */
+extern size_t MinPerfHashIndex(const MinPerfHash_t *hash, const void *key);
+
+/**
+ * @brief
+ *  Builds a read-only map of keys to data on a minimal perfect hash
+ *  function, where finding a key takes one hash per level tried and a single
+ *  compare. The map doesn't take ownership of the keys or data.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] keys          distinct keys of the map
+ * @param[in] data          data of each key, at the same index; NULL to only
+ *                          test membership
+ * @param[in] gamma         size of each level relative to the keys left for
+ *                          it, at least 1
+ * @param[in] hash_func     function to hash keys with a seed
+ * @param[in] comp_key      function to compare the keys
+ *
+ * @return
+ *  Pointer to the new map, NULL if unable to allocate memory or the keys
+ *  hold a duplicate.
+ */
+extern MinPerfHashMap_t *
+MinPerfHashMapCreate(const PointerArray_t *keys, const PointerArray_t *data,
+                     float gamma, size_t (*hash_func)(const void *, size_t),
+                     int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a read-only map on a minimal perfect hash function.
+ *
+ * @param[in,out] p_map         map to delete
+ */
+extern void MinPerfHashMapClear(MinPerfHashMap_t **p_map);
+
+/**
+ * @brief
+ *  Finds the data given the key in a read-only map on a minimal perfect hash
+ *  function.
+ *
+ * @param[in] map           map to search
+ * @param[in] key           key of the data
+ *
+ * @return
+ *  Data corresponding to the key, NULL if not found. Maps without data
+ *  return the stored key instead.
+ */
+extern void *MinPerfHashMapFind(const MinPerfHashMap_t *map, const void *key);
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file rcu_hashtable.h
+ *
+ * @brief
+ *  Structs and functions for read-copy-update hashtables, for read mostly
+ *  data shared between threads. Finds take no locks and do no atomic
+ *  read-modify-writes; they only announce the epoch they read in, in a slot
+ *  of their own. Adds and removes are serialised by a mutex, publish their
+ *  changes with atomic stores and retire unlinked entries and bucket arrays,
+ *  which are only freed once every reader has left the epochs that could
+ *  still see them.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef RCU_HASHTABLE_H
+#define RCU_HASHTABLE_H
+
+#include "hashtable_index.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define RCU_HT_ALIGN 64 // reader slots are aligned to a cache line so readers
+                        // don't invalidate each others' slots
+
+typedef struct RcuHTNode { // read-copy-update hashtable entry
+    void *key;             // Pointer to the key
+    void *data;            // Pointer to the data
+    size_t hash;           // cached hash of the key
+    struct RcuHTNode *_Atomic next;
+} RcuHTNode_t;
+
+typedef struct RcuHTArray {         // bucket array of a read-copy-update
+    size_t count;                   // hashtable; replaced as a whole when
+    RcuHTNode_t *_Atomic heads[];   // the table is rehashed
+} RcuHTArray_t;
+
+typedef struct RcuHTReader { // slot of a thread reading a read-copy-update
+                             // hashtable
+    _Alignas(RCU_HT_ALIGN) _Atomic size_t epoch; // epoch of the find in
+                                                 // progress; 0 if none
+    bool is_used;
+} RcuHTReader_t;
+
+typedef struct RcuHTRetired { // entry or array waiting to be freed
+    void *ptr;
+    void (*free_ptr)(void *);
+    size_t epoch; // last epoch that could still see ptr
+    struct RcuHTRetired *next;
+} RcuHTRetired_t;
+
+typedef struct RcuHashTable {    // read-copy-update hashtable
+    RcuHTArray_t *_Atomic array; // current bucket array
+    _Atomic size_t epoch;        // starts at 1, advanced by each write
+    RcuHTReader_t *readers;      // Dynamic array of reader slots
+    size_t reader_count;
+    RcuHTRetired_t *retired; // retired pointers, newest first
+    pthread_mutex_t lock;    // serialises writers and reader joins
+    size_t count;            // number of entries
+    HTIndexing_t indexing;   // how hashes are reduced to bucket indices
+    float max_load; // limit proportion of load when rehashing should occur;
+                    // 0 to disable the automatic rehashing
+    size_t (*hash)(const void *);
+    /**
+     *  The compare function must operate as follows: @n
+     *  1) Returns int < 0 if key_1 should come before key_2 @n
+     *  2) Returns int >= 0 if key_1 should come after key_2 @n
+     */
+    int (*comp_key)(const void *, const void *);
+} RcuHashTable_t;
+
+/**
+ * @brief
+ *  Creates a read-copy-update hashtable.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] bucket_count      initial number of buckets
+ * @param[in] max_load_prop     load proportion to rehash at;
+ *                              0 if no rehash wanted
+ * @param[in] indexing          how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
+ * @param[in] reader_count      most threads that can read at once
+ * @param[in] hash_func         function to hash keys
+ * @param[in] comp_key          function to compare the keys
+ *
+ * @return Pointer to the new hashtable, NULL if unable to allocate memory.
+ */
+extern RcuHashTable_t *
+RcuHashTableCreate(size_t bucket_count, float max_load_prop,
+                   HTIndexing_t indexing, size_t reader_count,
+                   size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a read-copy-update hashtable and frees it's contents if provided
+ *  with a function do so. Must not be called while other threads use the
+ *  table.
+ *
+ * @param[in,out] p_table       hashtable to delete
+ * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ */
+extern void RcuHashTableClear(RcuHashTable_t **p_table,
+                              void (*free_data)(void *),
+                              void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Claims a reader slot of a read-copy-update hashtable for the calling
+ *  thread, to be passed to each of its finds.
+ *
+ * @param[in,out] table         hashtable to read
+ *
+ * @return Reader slot, NULL if all reader_count slots are taken.
+ */
+extern RcuHTReader_t *RcuHashTableJoin(RcuHashTable_t *table);
+
+/**
+ * @brief
+ *  Gives back a reader slot claimed with RcuHashTableJoin.
+ *
+ * @param[in,out] table         hashtable the slot belongs to
+ * @param[in,out] reader        slot to give back
+ */
+extern void RcuHashTableLeave(RcuHashTable_t *table, RcuHTReader_t *reader);
+
+/**
+ * @brief
+ *  Adds a new key-value pair to a read-copy-update hashtable. Rehashes if the
+ *  max load limit has been reached by publishing a doubled copy of the
+ *  buckets.
+ *
+ * @param[in,out] table         hashtable to add to
+ * @param[in]     key           key of the new item
+ * @param[in]     data          data of the new item
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : memory allocation falied @n
+ */
+extern bool RcuHashTableAdd(RcuHashTable_t *table, void *key, void *data);
+
+/**
+ * @brief
+ *  Removes a key-value pair from a read-copy-update hashtable and frees it's
+ *  data and key, once no reader can see them, if provided with functions to
+ *  do so.
+ *
+ * @param[in,out] table         hashtable to remove from
+ * @param[in]     key           key of the item to remove
+ * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return
+ *  true  : removed @n
+ *  false : key not found @n
+ */
+extern bool RcuHashTableRemove(RcuHashTable_t *table, void *key,
+                               void (*free_data)(void *),
+                               void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Finds the data given the key in a read-copy-update hashtable, without
+ *  blocking or being blocked by writers. The data itself isn't guarded; the
+ *  caller must make sure no other thread removes and frees it while in use.
+ *
+ * @param[in]     table         hashtable to search
+ * @param[in,out] reader        slot of the calling thread
+ * @param[in]     key           key of the data
+ *
+ * @return Data corresponding to the key, NULL if not found.
+ */
+extern void *RcuHashTableFind(RcuHashTable_t *table, RcuHTReader_t *reader,
+                              void *key);
+#endif
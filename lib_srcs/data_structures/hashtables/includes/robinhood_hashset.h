@@ -0,0 +1,175 @@
+/**
+ * @file robinhood_hashset.h
+ *
+ * @brief
+ *  Structs and functions for robinhood open address hashsets. Only the key
+ *  pointers and probe sequence lengths are stored, with no data or cached
+ *  hash, for membership tests and deduplication; a bucket takes 9 bytes
+ *  instead of the 25 of a robinhood hashtable.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef ROBINHOOD_HASHSET_H
+#define ROBINHOOD_HASHSET_H
+
+#include "hashtable_index.h"
+#include "robinhood_hashtable.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct RobinHashSet { // robinhood open address hashset
+    void **keys;              // Dynamic array of keys stored inline
+    unsigned char *psls; // probe sequence lengths + 1 of each bucket; 0 if the
+                         // bucket is empty
+    struct {
+        size_t max;
+        size_t used;
+        size_t limit; // buckets used at which an add rehashes; max_load * max
+                      // rounded up, so the check needs no float division
+    } count; // tracks the total amount of buckets and the amount used
+    HTIndexing_t indexing; // how hashes are reduced to bucket indices
+    float max_load; // limit proportion of load when rehashing should occur;
+                    // 0 to disable the automatic rehashing (a probe sequence
+                    // longer than max_psl may still force one)
+    unsigned char max_psl; // longest probe sequence an add allows before
+                           // forcing a rehash; ROBIN_HT_MAX_PSL (default) or
+                           // lower for a tighter worst case lookup
+    size_t (*hash)(const void *);
+    /**
+     *  The compare function must operate as follows: @n
+     *  1) Returns int < 0 if key_1 should come before key_2 @n
+     *  2) Returns int >= 0 if key_1 should come after key_2 @n
+     */
+    int (*comp_key)(const void *, const void *);
+} RobinHashSet_t;
+
+/**
+ * @brief
+ *  Creates a robinhood open address hashset.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] bucket_count      initial number of buckets
+ * @param[in] max_load_prop     load proportion to rehash at; 0-1;
+ *                          0 if no rehash wanted
+ * @param[in] indexing          how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
+ * @param[in] hash_func         function to hash keys
+ * @param[in] comp_key          function to compare the keys
+ *
+ * @return Pointer to the new hashset, NULL if unable to allocate memory.
+ */
+extern RobinHashSet_t *
+RobinHashSetCreate(size_t bucket_count, float max_load_prop,
+                   HTIndexing_t indexing, size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a robinhood open address hashset and frees it's keys if provided
+ *  with a function do so.
+ *
+ * @param[in,out] p_set         hashset to delete
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ */
+extern void RobinHashSetClear(RobinHashSet_t **p_set,
+                              void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Adds a key to a robinhood open address hashset if it isn't in it already.
+ *  Rehashes if the max load limit has been reached or if a probe sequence
+ *  would grow past max_psl by doubling the current number of buckets.
+ *
+ * @param[in,out] set           hashset to add to
+ * @param[in]     key           key to add
+ *
+ * @return
+ *   1 : added successfully @n
+ *   0 : the key is already in the set @n
+ *  -1 : memory allocation falied, the set is full or the key collides with
+ *       too many others @n
+ */
+extern int RobinHashSetAdd(RobinHashSet_t *set, void *key);
+
+/**
+ * @brief
+ *  Removes a key from a robinhood open address hashset and frees it if
+ *  provided with a function do so.
+ *
+ * @param[in,out] set           hashset to remove from
+ * @param[in]     key           key to remove
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return
+ *  true  : removed successfully @n
+ *  false : the key isn't in the set @n
+ */
+extern bool RobinHashSetRemove(RobinHashSet_t *set, const void *key,
+                               void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Checks if a key is in a robinhood open address hashset.
+ *
+ * @param[in] set           hashset to search
+ * @param[in] key           key to find
+ *
+ * @return
+ *  true  : the key is in the set @n
+ *  false : the key isn't in the set @n
+ */
+extern bool RobinHashSetContains(const RobinHashSet_t *set, const void *key);
+
+/**
+ * @brief
+ *  Adds every key of another robinhood open address hashset to a hashset,
+ *  growing it once up front. The keys are shared, not copied.
+ *
+ * @param[in,out] set           hashset to add to
+ * @param[in]     other         hashset to add the keys of
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : a key couldn't be added, as in RobinHashSetAdd @n
+ */
+extern bool RobinHashSetUnion(RobinHashSet_t *set,
+                              const RobinHashSet_t *other);
+
+/**
+ * @brief
+ *  Removes every key of a robinhood open address hashset that isn't in
+ *  another hashset, in one sweep of the buckets, and frees them if provided
+ *  with a function do so.
+ *
+ * @param[in,out] set           hashset to remove from
+ * @param[in]     other         hashset of the keys to keep
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return Number of keys removed.
+ */
+extern size_t RobinHashSetIntersect(RobinHashSet_t *set,
+                                    const RobinHashSet_t *other,
+                                    void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Removes every key of a robinhood open address hashset that is in another
+ *  hashset, in one sweep of the buckets, and frees them if provided with a
+ *  function do so.
+ *
+ * @param[in,out] set           hashset to remove from
+ * @param[in]     other         hashset of the keys to remove
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return Number of keys removed.
+ */
+extern size_t RobinHashSetDifference(RobinHashSet_t *set,
+                                     const RobinHashSet_t *other,
+                                     void (*free_key)(void *));
+#endif
@@ -11,24 +11,58 @@
 #ifndef ROBINHOOD_HASHTABLE_H
 #define ROBINHOOD_HASHTABLE_H
 
+#include "hashtable_index.h"
+#include "hashtable_stats.h"
+#include <limits.h>
 #include <stddef.h>
 #include <stdbool.h>
 
+#define ROBIN_HT_MAX_PSL (UCHAR_MAX - 1) // longest probe sequence allowed
+
 typedef struct RobinHTBucket { // robinhood open address hashtable bucket
     void *key;         // Pointer to the key
     void *data;        // Pointer to the data
-    size_t psl;        // probe sequence lengths, used to manage the hashtable
+    size_t hash;       // cached hash of the key
 } RobinHTBucket_t;
 
 typedef struct RobinHashTable {             // robinhood open address hastable
-    RobinHTBucket_t **buckets; // Dynamic array of pointers to the buckets
+    RobinHTBucket_t *buckets; // Dynamic array of buckets stored inline
+    unsigned char *psls; // probe sequence lengths + 1 of each bucket, used to
+                         // manage the hashtable; 0 if the bucket is empty
     struct {
         size_t max;
         size_t used;
+        size_t limit; // buckets used at which an add rehashes; max_load * max
+                      // rounded up, so the check needs no float division
     } count;        // tracks the total amount of buckets and the amount used
+    struct {
+        RobinHTBucket_t *buckets;
+        unsigned char *psls;
+        size_t max;    // total amount of old buckets
+        size_t used;   // entries left in the old buckets
+        size_t first;  // first bucket to be migrated
+        size_t cursor; // next bucket to be migrated
+        size_t done;   // amount of buckets migrated so far
+    } old; // buckets from before an incremental rehash, still being migrated;
+           // buckets is NULL when no migration is in progress
+    size_t rehash_step; // old buckets migrated by each add, remove and find
+                        // during an incremental rehash; 0 (default) to
+                        // rehash all at once
+    HTRehashes_t rehashes; // rehashes done so far and time spent on them
+#ifdef HT_STATS
+    HTCounters_t counters; // work done by lookups
+#endif
+    HTIndexing_t indexing; // how hashes are reduced to bucket indices
     float max_load; // limit proportion of load when rehashing should occur;
-                    // 0 to disable the automatic rehashing
+                    // 0 to disable the automatic rehashing (a probe sequence
+                    // longer than max_psl may still force one)
+    unsigned char max_psl; // longest probe sequence an add allows before
+                           // forcing a rehash; ROBIN_HT_MAX_PSL (default) or
+                           // lower for a tighter worst case lookup
     size_t (*hash)(const void *);
+    size_t (*seeded_hash)(const void *, size_t); // used instead of hash when
+                                                 // set, called with seed
+    size_t seed; // random seed of the table, set by the seeded create
     /**
      *  The compare function must operate as follows: @n
      *  1) Returns int < 0 if key_1 should come before key_2 @n
@@ -37,6 +71,14 @@ typedef struct RobinHashTable {             // robinhood open address hastable
     int (*comp_key)(const void *, const void *);
 } RobinHashTable_t;
 
+typedef struct RobinHTIter { // position of an iterator over a robinhood open
+                             // address hashtable
+    size_t i;                // next bucket to look at
+    bool is_old;             // whether i is in the old buckets
+    void *key;               // key of the current entry
+    void *data;              // data of the current entry
+} RobinHTIter_t;
+
 /**
  * @brief
  *  Creates a robinhood open address hashtable.
@@ -49,6 +91,8 @@ typedef struct RobinHashTable {             // robinhood open address hastable
  * @param[in] bucket_count      initial number of buckets
  * @param[in] max_load_prop     load proportion to rehash at; 0-1;
  *                          0 if no rehash wanted
+ * @param[in] indexing          how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
  * @param[in] hash_func         function to hash keys
  * @param[in] comp_key          function to compare the keys
  *
@@ -56,9 +100,35 @@ typedef struct RobinHashTable {             // robinhood open address hastable
  */
 extern RobinHashTable_t *
 RobinHashTableCreate(size_t bucket_count, float max_load_prop,
-                     size_t (*hash_func)(const void *),
+                     HTIndexing_t indexing, size_t (*hash_func)(const void *),
                      int (*comp_key)(const void *, const void *));
 
+/**
+ * @brief
+ *  Creates a robinhood open address hashtable that hashes its keys with a
+ *  random seed of its own, so that which keys collide can't be predicted
+ *  from outside the process.
+ *
+ * @note
+ *  For keys from untrusted input use a keyed hash such as sipStrHash; a
+ *  fast seeded hash such as wyStrHashSeeded only spreads the load.
+ *
+ * @param[in] bucket_count      initial number of buckets
+ * @param[in] max_load_prop     load proportion to rehash at; 0-1;
+ *                          0 if no rehash wanted
+ * @param[in] indexing          how hashes are reduced to bucket indices;
+ *                          HT_INDEX_MASK rounds bucket_count up to a power of 2
+ * @param[in] hash_func         function to hash keys with a seed
+ * @param[in] comp_key          function to compare the keys
+ *
+ * @return Pointer to the new hashtable, NULL if unable to allocate memory.
+ */
+extern RobinHashTable_t *
+RobinHashTableCreateSeeded(size_t bucket_count, float max_load_prop,
+                           HTIndexing_t indexing,
+                           size_t (*hash_func)(const void *, size_t),
+                           int (*comp_key)(const void *, const void *));
+
 /**
  * @brief
  *  Deletes a robinhood open address hashtable. and frees it's contents
@@ -75,8 +145,14 @@ extern void RobinHashTableClear(RobinHashTable_t **p_table,
 /**
  * @brief
  *  Adds a new key-value pair to a robinhood open address hashtable.
- *  Rehashes if the max load limit has been reached by doubling the current
- *  number of buckets.
+ *  Rehashes if the max load limit has been reached or if a probe sequence
+ *  would grow past max_psl by doubling the current number of buckets.
+ *
+ * @note
+ *  If rehash_step is set, reaching the max load limit instead starts an
+ *  incremental rehash: the current buckets become the old buckets, and each
+ *  following add, remove and find moves rehash_step of them into the doubled
+ *  buckets until none are left.
  *
  * @param[in,out] table         hashtable to add to
  * @param[in]     key           key of the new item
@@ -84,7 +160,8 @@ extern void RobinHashTableClear(RobinHashTable_t **p_table,
  *
  * @return
  *  true  : added successfully @n
- *  false : memory allocation falied @n
+ *  false : memory allocation falied, or the key collides with too many
+ *          others to fit within ROBIN_HT_MAX_PSL @n
  */
 extern bool RobinHashTableAdd(RobinHashTable_t *table, void *key,
                              void *data);
@@ -92,19 +169,43 @@ extern bool RobinHashTableAdd(RobinHashTable_t *table, void *key,
 /**
  * @brief
  *  Removes a key-value pair from a robinhood open address hashtable
- *  and frees it's contents if provided with a function do so.
+ *  and frees it's key if provided with a function do so. The data is
+ *  returned rather than freed, so the caller owns it.
  *
  * @param[in,out] table         hashtable to remove from
- * @param[in]     key           key of the item to remove=
- * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     key           key of the item to remove
  * @param[in]     free_key      function to free keys; NULL if not needed
  *
  * @return Pointer the data of the removed item, NULL if not found.
  */
 extern void *RobinHashTableRemove(RobinHashTable_t *table, void *key,
-                                  void (*free_data)(void *),
                                   void (*free_key)(void *));
 
+/**
+ * @brief
+ *  Removes every key-value pair of a robinhood open address hashtable that
+ *  matches a predicate and frees it's contents if provided with a function do
+ *  so. The buckets are swept once and the entries left are shifted back over
+ *  the removed ones as the sweep goes, instead of shifting a cluster back for
+ *  each removal. Finishes any incremental rehash in progress first.
+ *
+ * @param[in,out] table         hashtable to remove from
+ * @param[in]     pred          function returning true for the items to
+ *                              remove, called once per item with arg
+ * @param[in]     arg           passed to pred; NULL if not needed
+ * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return
+ *  Number of items removed, 0 if none or the incremental rehash couldn't be
+ *  finished for lack of memory.
+ */
+extern size_t RobinHashTableRemoveIf(RobinHashTable_t *table,
+                                     bool (*pred)(const void *, const void *,
+                                                  void *),
+                                     void *arg, void (*free_data)(void *),
+                                     void (*free_key)(void *));
+
 /**
  * @brief
  *  Finds the data given the key in a robinhood open address hashtable.
@@ -118,16 +219,113 @@ extern void *RobinHashTableFind(RobinHashTable_t *table, void *key);
 
 /**
  * @brief
- *  Rehashes a robinhood open address hashtable.
+ *  Finds the data of many keys in a robinhood open address hashtable. The
+ *  keys are hashed and their home buckets prefetched HT_FIND_BATCH at a time
+ *  before any is probed, so the cache misses of a batch overlap.
+ *
+ * @param[in]  table        hashtable to search
+ * @param[in]  keys         keys of the data
+ * @param[in]  key_count    number of keys
+ * @param[out] results      data corresponding to each key, NULL if not found
+ */
+extern void RobinHashTableFindBatch(RobinHashTable_t *table, void **keys,
+                                    size_t key_count, void **results);
+
+/**
+ * @brief
+ *  Rehashes a robinhood open address hashtable, finishing any incremental
+ *  rehash in progress first.
  *
  * @param[in,out] table         hashtable to rehash
- * @param[in]     new_count     new number of buckets
+ * @param[in]     new_count     new number of buckets, rounded up to a power
+ *                              of 2 for HT_INDEX_MASK
  *
  * @return
  *   1 : rehashed successfully @n
- *   0 : unable to allocate memory @n
+ *   0 : unable to allocate memory, or a probe sequence would exceed
+ *       ROBIN_HT_MAX_PSL in the new buckets @n
  *  -1 : new count is less than current limit of available buckets
- *       (max_load_prop*max_count) @n
+ *       (count.limit) @n
  */
 extern int RobinHashTableRehash(RobinHashTable_t *table, size_t new_count);
+
+/**
+ * @brief
+ *  Grows a robinhood open address hashtable, if needed, so that it can hold
+ *  entry_count entries without rehashing again, finishing any incremental
+ *  rehash in progress first.
+ *
+ * @param[in,out] table         hashtable to grow
+ * @param[in]     entry_count   number of entries to make room for
+ *
+ * @return
+ *  true  : reserved successfully, or already large enough @n
+ *  false : memory allocation falied @n
+ */
+extern bool RobinHashTableReserve(RobinHashTable_t *table, size_t entry_count);
+
+/**
+ * @brief
+ *  Starts an iterator over a robinhood open address hashtable. Nothing is
+ *  allocated; the iterator walks the buckets in order, then any old buckets
+ *  still being migrated. The table must not change while it is iterated,
+ *  which includes finds during an incremental rehash.
+ *
+ * @param[in]  table        hashtable to iterate over
+ * @param[out] iter         iterator to start
+ */
+extern void RobinHashTableIterBegin(const RobinHashTable_t *table,
+                                    RobinHTIter_t *iter);
+
+/**
+ * @brief
+ *  Moves an iterator to the next entry of a robinhood open address
+ *  hashtable, setting it's key and data.
+ *
+ * @param[in]     table     hashtable being iterated over
+ * @param[in,out] iter      iterator to move
+ *
+ * @return
+ *  true  : moved to the next entry @n
+ *  false : reached the end of the table @n
+ */
+extern bool RobinHashTableIterNext(const RobinHashTable_t *table,
+                                   RobinHTIter_t *iter);
+
+/**
+ * @brief
+ *  Visits the entries of at least step home buckets of a robinhood open
+ *  address hashtable, starting at a cursor, so a table can be walked a bit
+ *  at a time while it keeps being changed. Start with cursor 0 and pass back
+ *  the cursor returned until it is 0 again. @n
+ *  With HT_INDEX_MASK the cursor is advanced with reversed bits, so every
+ *  entry present for the whole scan is visited even if the table is rehashed
+ *  between calls, though some may be visited twice. With other indexing it
+ *  only holds if the table isn't rehashed during the scan.
+ *
+ * @param[in,out] table     hashtable to scan
+ * @param[in]     cursor    cursor returned by the last call; 0 to start
+ * @param[in]     step      number of home buckets to visit at least
+ * @param[in]     func      function called with the key, data and arg of each
+ *                          entry visited; must not change the table
+ * @param[in]     arg       passed to func; NULL if not needed
+ *
+ * @return Cursor to continue from, 0 once the scan is complete.
+ */
+extern size_t RobinHashTableScan(RobinHashTable_t *table, size_t cursor,
+                                 size_t step,
+                                 void (*func)(void *, void *, void *),
+                                 void *arg);
+
+/**
+ * @brief
+ *  Gets the load, probe sequence lengths and rehash record of a robinhood
+ *  open address hashtable, counting any old buckets still being migrated.
+ *  The histogram holds the entries by probe sequence length.
+ *
+ * @param[in]  table        hashtable to inspect
+ * @param[out] stats        statistics of the table
+ */
+extern void RobinHashTableStats(const RobinHashTable_t *table,
+                                HTStats_t *stats);
 #endif
@@ -0,0 +1,121 @@
+/**
+ * @file robinhood_hashtable_file.h
+ *
+ * @brief
+ *  Structs and functions for a flat, read-only robinhood hashtable file
+ *  format. A robinhood hashtable of byte string keys and data is written out
+ *  with its entries rehashed into a fixed size robinhood layout and every
+ *  pointer replaced by an offset from the start of the file, so the file can
+ *  be memory mapped and searched as is, with no deserialising, and its pages
+ *  shared between processes. @n
+ *  Files hold fixed width fields in the byte order of the machine writing
+ *  them and are only opened on machines of the same byte order.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef ROBINHOOD_HASHTABLE_FILE_H
+#define ROBINHOOD_HASHTABLE_FILE_H
+
+#include "robinhood_hashtable.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define ROBIN_HT_FILE_MAGIC "RHTFILE" // first bytes of every file
+#define ROBIN_HT_FILE_VERSION 1
+#define ROBIN_HT_FILE_ORDER 0x01020304u // byte order mark
+#define ROBIN_HT_FILE_SEED 0x2D358DCCAA6C78A5ull // seed the keys are hashed
+                                                 // with by the writer
+#define ROBIN_HT_FILE_LOAD 0.85 // most entries per slot of a written file
+
+typedef struct RobinHTFileHeader { // start of a robinhood hashtable file
+    char magic[8];                 // ROBIN_HT_FILE_MAGIC
+    uint32_t version;              // ROBIN_HT_FILE_VERSION
+    uint32_t order;                // ROBIN_HT_FILE_ORDER as written
+    uint64_t slot_count;           // power of 2
+    uint64_t entry_count;
+    uint64_t seed;      // seed of wyHashSeeded over the bytes of the keys
+    uint64_t slots_off; // offsets from the start of the file to the
+    uint64_t psls_off;  // slots, their probe sequence lengths and the key
+    uint64_t heap_off;  // and data bytes
+    uint64_t file_size;
+} RobinHTFileHeader_t;
+
+typedef struct RobinHTFileSlot { // entry of a robinhood hashtable file
+    uint64_t hash;               // hash of the key
+    uint64_t key_off;            // offsets from the start of the file to the
+    uint64_t data_off;           // bytes of the key and data
+    uint32_t key_len;
+    uint32_t data_len;
+} RobinHTFileSlot_t;
+
+typedef struct RobinHTFile {              // opened robinhood hashtable file
+    const unsigned char *bytes;           // the mapped file
+    size_t size;                          // size of the file in bytes
+    const RobinHTFileHeader_t *header;
+    const RobinHTFileSlot_t *slots;
+    const unsigned char *psls; // probe sequence lengths + 1 of each slot; 0
+                               // if the slot is empty
+} RobinHTFile_t;
+
+/**
+ * @brief
+ *  Writes a robinhood open address hashtable to a file in the robinhood
+ *  hashtable file format. The keys and data are written as byte strings of
+ *  the sizes given by key_size and data_size, up to UINT32_MAX bytes each.
+ *
+ * @param[in] table         hashtable to write
+ * @param[in] key_size      function returning the number of bytes of a key
+ * @param[in] data_size     function returning the number of bytes of data
+ * @param[in] file_dest     file to write to, opened in binary mode
+ *
+ * @return
+ *  true  : written successfully @n
+ *  false : memory allocation or writing falied, a key or data is too
+ *          large, or more than ROBIN_HT_MAX_PSL keys hash alike @n
+ */
+extern bool RobinHashTableWriteBinary(const RobinHashTable_t *table,
+                                      size_t (*key_size)(const void *),
+                                      size_t (*data_size)(const void *),
+                                      FILE *file_dest);
+
+/**
+ * @brief
+ *  Opens a robinhood hashtable file by memory mapping it read-only, checking
+ *  that its header and layout fit within the file.
+ *
+ * @param[in] file_name     path of the file
+ *
+ * @return
+ *  Pointer to the opened file, NULL if it couldn't be opened or mapped or
+ *  isn't a valid robinhood hashtable file.
+ */
+extern RobinHTFile_t *RobinHTFileOpen(const char *file_name);
+
+/**
+ * @brief
+ *  Unmaps and closes a robinhood hashtable file. Any data found in it must
+ *  no longer be used.
+ *
+ * @param[in,out] p_file        file to close
+ */
+extern void RobinHTFileClose(RobinHTFile_t **p_file);
+
+/**
+ * @brief
+ *  Finds the data given the key in a robinhood hashtable file. The data is
+ *  returned in place, in the mapped file.
+ *
+ * @param[in]  file         file to search
+ * @param[in]  key          bytes of the key
+ * @param[in]  key_len      number of bytes of the key
+ * @param[out] p_data_len   number of bytes of the data; NULL if not needed
+ *
+ * @return Bytes of the data corresponding to the key, NULL if not found.
+ */
+extern const void *RobinHTFileFind(const RobinHTFile_t *file, const void *key,
+                                   size_t key_len, size_t *p_data_len);
+#endif
@@ -0,0 +1,298 @@
+/**
+ * @file robinhood_hashtable_typed.h
+ *
+ * @brief
+ *  Macros for generating robinhood open address hashtables specialised for a
+ *  key and data type. Keys and data are stored inline in the buckets rather
+ *  than as pointers, and the hash and compare are called directly so they
+ *  can be inlined, instead of through function pointers. The tables always
+ *  use the HT_INDEX_MASK indexing.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef ROBINHOOD_HASHTABLE_TYPED_H
+#define ROBINHOOD_HASHTABLE_TYPED_H
+
+#include "hashtable_index.h"
+#include "robinhood_hashtable.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/**
+ * @brief
+ *  Hashes an integer key for defRobinHashTable; mixing is left to the
+ *  table's indexing.
+ */
+#define robinHTHashInt(key) ((size_t)(key))
+
+/**
+ * @brief
+ *  Compares two keys with == for defRobinHashTable.
+ */
+#define robinHTEqual(key_1, key_2) ((key_1) == (key_2))
+
+/**
+ * @brief
+ *  Declares a robinhood open address hashtable, name_t, for the provided key
+ *  and data types, along with its functions: @n
+ *  name_t *nameCreate(size_t bucket_count, float max_load_prop) @n
+ *  void nameClear(name_t **p_table) @n
+ *  int nameRehash(name_t *table, size_t new_count) @n
+ *  bool nameAdd(name_t *table, key_type key, data_type data) @n
+ *  bool nameRemove(name_t *table, key_type key, data_type *p_data) @n
+ *  data_type *nameFind(name_t *table, key_type key) @n
+ *  They behave as the RobinHashTable functions with the same names, except
+ *  that remove reports whether the key was found and copies out its data,
+ *  and find returns a pointer to the data stored in the table, valid until
+ *  the next add, remove or rehash.
+ *
+ * @attention
+ *  The hash and compare are used as hash_func(key) returning a size_t, and
+ *  equal_func(key_1, key_2) returning nonzero if the keys are equal. Either
+ *  may be a function or a macro.
+ *
+ * @warning
+ *  The table doesn't own what its keys or data point to; free those before
+ *  clearing it if needed.
+ *
+ * @example
+ *  defRobinHashTable(IntMap, int, double, robinHTHashInt, robinHTEqual)
+ *  IntMap_t *map = IntMapCreate(16, 0.9);
+ */
+#define defRobinHashTable(name, key_type, data_type, hash_func, equal_func)    \
+    typedef struct name##Bucket {                                              \
+        key_type key;                                                          \
+        data_type data;                                                        \
+    } name##Bucket_t;                                                          \
+                                                                               \
+    typedef struct name {                                                      \
+        name##Bucket_t *buckets;                                               \
+        unsigned char *psls;                                                   \
+        struct {                                                               \
+            size_t max;                                                        \
+            size_t used;                                                       \
+            size_t limit;                                                      \
+        } count;                                                               \
+        float max_load;                                                        \
+    } name##_t;                                                                \
+                                                                               \
+    static inline void name##_setMaxCount(name##_t *table, size_t max_count)   \
+    {                                                                          \
+        table->count.max = max_count;                                          \
+        double limit = (double)table->max_load * max_count;                    \
+        table->count.limit = (size_t)limit;                                    \
+        if ((double)table->count.limit < limit) {                              \
+            table->count.limit += 1;                                           \
+        }                                                                      \
+        if (table->max_load == 0 || table->count.limit > max_count) {          \
+            table->count.limit = max_count;                                    \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    static inline size_t name##_grownCount(const name##_t *table)              \
+    {                                                                          \
+        if (table->count.max > SIZE_MAX / 2 / sizeof(name##Bucket_t)) {        \
+            return 0;                                                          \
+        }                                                                      \
+        return 2 * table->count.max;                                           \
+    }                                                                          \
+                                                                               \
+    static inline bool name##_canAdd(const unsigned char *psls, size_t i,      \
+                                     size_t max_count)                         \
+    {                                                                          \
+        unsigned int psl = 1;                                                  \
+        while (psls[i] != 0) {                                                 \
+            if (psls[i] < psl) {                                               \
+                psl = psls[i];                                                 \
+            }                                                                  \
+            if (++psl > ROBIN_HT_MAX_PSL + 1) {                                \
+                return false;                                                  \
+            }                                                                  \
+            i = HTIndexingNext(HT_INDEX_MASK, i, max_count);                   \
+        }                                                                      \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline bool name##_insert(name##Bucket_t *buckets,                  \
+                                     unsigned char *psls,                      \
+                                     name##Bucket_t bucket, size_t max_count)  \
+    {                                                                          \
+        size_t i = HTIndexingReduce(HT_INDEX_MASK, hash_func(bucket.key),      \
+                                    max_count);                                \
+        unsigned int psl = 1;                                                  \
+        while (psls[i] != 0) {                                                 \
+            if (psls[i] < psl) {                                               \
+                name##Bucket_t tmp_bucket = buckets[i];                        \
+                unsigned int tmp_psl = psls[i];                                \
+                buckets[i] = bucket;                                           \
+                psls[i] = psl;                                                 \
+                bucket = tmp_bucket;                                           \
+                psl = tmp_psl;                                                 \
+            }                                                                  \
+            if (++psl > ROBIN_HT_MAX_PSL + 1) {                                \
+                return false;                                                  \
+            }                                                                  \
+            i = HTIndexingNext(HT_INDEX_MASK, i, max_count);                   \
+        }                                                                      \
+        buckets[i] = bucket;                                                   \
+        psls[i] = psl;                                                         \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline bool name##_findIdx(const name##_t *table, key_type key,     \
+                                      size_t *idx)                             \
+    {                                                                          \
+        size_t i = HTIndexingReduce(HT_INDEX_MASK, hash_func(key),             \
+                                    table->count.max);                         \
+        for (unsigned int psl = 1; psl <= table->psls[i]; psl++) {             \
+            if (equal_func(table->buckets[i].key, key)) {                      \
+                *idx = i;                                                      \
+                return true;                                                   \
+            }                                                                  \
+            i = HTIndexingNext(HT_INDEX_MASK, i, table->count.max);            \
+        }                                                                      \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline name##_t *name##Create(size_t bucket_count,                  \
+                                         float max_load_prop)                  \
+    {                                                                          \
+        name##_t *new_table = malloc(sizeof(name##_t));                        \
+        if (new_table == NULL) {                                               \
+            return NULL;                                                       \
+        }                                                                      \
+        new_table->count.used = 0;                                             \
+        new_table->max_load = max_load_prop;                                   \
+        name##_setMaxCount(new_table,                                          \
+                           HTIndexingRound(HT_INDEX_MASK, bucket_count));      \
+        new_table->buckets                                                     \
+            = malloc(new_table->count.max * sizeof(name##Bucket_t));           \
+        new_table->psls = calloc(new_table->count.max, 1);                     \
+        if (new_table->buckets == NULL || new_table->psls == NULL) {           \
+            free(new_table->buckets);                                          \
+            free(new_table->psls);                                             \
+            free(new_table);                                                   \
+            return NULL;                                                       \
+        }                                                                      \
+        return new_table;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline void name##Clear(name##_t **p_table)                         \
+    {                                                                          \
+        assert(p_table != NULL);                                               \
+        assert(*p_table != NULL);                                              \
+                                                                               \
+        free((*p_table)->buckets);                                             \
+        free((*p_table)->psls);                                                \
+        free(*p_table);                                                        \
+        *p_table = NULL;                                                       \
+    }                                                                          \
+                                                                               \
+    static inline int name##Rehash(name##_t *table, size_t new_count)          \
+    {                                                                          \
+        assert(table != NULL);                                                 \
+                                                                               \
+        new_count = HTIndexingRound(HT_INDEX_MASK, new_count);                 \
+        float max_load = (table->max_load == 0) ? 1 : table->max_load;         \
+        if (max_load * new_count < table->count.used) {                        \
+            return -1;                                                         \
+        }                                                                      \
+        name##Bucket_t *new_buckets                                            \
+            = malloc(new_count * sizeof(name##Bucket_t));                      \
+        unsigned char *new_psls = calloc(new_count, 1);                        \
+        if (new_buckets == NULL || new_psls == NULL) {                         \
+            free(new_buckets);                                                 \
+            free(new_psls);                                                    \
+            return 0;                                                          \
+        }                                                                      \
+        for (size_t i = 0; i < table->count.max; i++) {                        \
+            if (table->psls[i] != 0                                            \
+                && !name##_insert(new_buckets, new_psls, table->buckets[i],    \
+                                  new_count)) {                                \
+                free(new_buckets);                                             \
+                free(new_psls);                                                \
+                return 0;                                                      \
+            }                                                                  \
+        }                                                                      \
+        free(table->buckets);                                                  \
+        free(table->psls);                                                     \
+        table->buckets = new_buckets;                                          \
+        table->psls = new_psls;                                                \
+        name##_setMaxCount(table, new_count);                                  \
+        return 1;                                                              \
+    }                                                                          \
+                                                                               \
+    static inline bool name##Add(name##_t *table, key_type key,                \
+                                 data_type data)                               \
+    {                                                                          \
+        assert(table != NULL);                                                 \
+                                                                               \
+        size_t used = table->count.used;                                       \
+        if (used >= table->count.limit) {                                      \
+            if (table->max_load == 0 || name##_grownCount(table) == 0          \
+                || name##Rehash(table, name##_grownCount(table)) == 0) {       \
+                return false;                                                  \
+            }                                                                  \
+        }                                                                      \
+        size_t i = HTIndexingReduce(HT_INDEX_MASK, hash_func(key),             \
+                                    table->count.max);                         \
+        if (!name##_canAdd(table->psls, i, table->count.max)) {                \
+            /* under 1/8 load, growing won't help keys that collide */         \
+            if (used <= (table->count.max - 1) / 8                             \
+                || name##_grownCount(table) == 0                               \
+                || name##Rehash(table, name##_grownCount(table)) != 1) {       \
+                return false;                                                  \
+            }                                                                  \
+            i = HTIndexingReduce(HT_INDEX_MASK, hash_func(key),                \
+                                 table->count.max);                            \
+            if (!name##_canAdd(table->psls, i, table->count.max)) {            \
+                return false;                                                  \
+            }                                                                  \
+        }                                                                      \
+        name##Bucket_t new_bucket = {.key = key, .data = data};                \
+        name##_insert(table->buckets, table->psls, new_bucket,                 \
+                      table->count.max);                                       \
+        table->count.used += 1;                                                \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline bool name##Remove(name##_t *table, key_type key,             \
+                                    data_type *p_data)                         \
+    {                                                                          \
+        assert(table != NULL);                                                 \
+                                                                               \
+        size_t i;                                                              \
+        if (!name##_findIdx(table, key, &i)) {                                 \
+            return false;                                                      \
+        }                                                                      \
+        if (p_data != NULL) {                                                  \
+            *p_data = table->buckets[i].data;                                  \
+        }                                                                      \
+        size_t next = HTIndexingNext(HT_INDEX_MASK, i, table->count.max);      \
+        while (table->psls[next] > 1) {                                        \
+            table->buckets[i] = table->buckets[next];                          \
+            table->psls[i] = table->psls[next] - 1;                            \
+            i = next;                                                          \
+            next = HTIndexingNext(HT_INDEX_MASK, i, table->count.max);         \
+        }                                                                      \
+        table->psls[i] = 0;                                                    \
+        table->count.used -= 1;                                                \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline data_type *name##Find(name##_t *table, key_type key)         \
+    {                                                                          \
+        assert(table != NULL);                                                 \
+                                                                               \
+        size_t i;                                                              \
+        if (!name##_findIdx(table, key, &i)) {                                 \
+            return NULL;                                                       \
+        }                                                                      \
+        return &table->buckets[i].data;                                        \
+    }
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @file sharded_hashtable.h
+ *
+ * @brief
+ *  Structs and functions for thread-safe sharded hashtables. Keys are
+ *  partitioned by the high bits of their mixed hash across a power of 2
+ *  number of robinhood hashtables, each guarded by its own reader-writer
+ *  lock, so threads working on different shards never contend and finds on
+ *  the same shard run in parallel.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef SHARDED_HASHTABLE_H
+#define SHARDED_HASHTABLE_H
+
+#include "robinhood_hashtable.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SHARD_HT_ALIGN 64 // shards are aligned to a cache line so locking one
+                          // doesn't invalidate its neighbours
+
+typedef struct ShardHTShard { // independently locked part of the hashtable
+    _Alignas(SHARD_HT_ALIGN) pthread_rwlock_t lock;
+    RobinHashTable_t *table;
+} ShardHTShard_t;
+
+typedef struct ShardHashTable { // thread-safe sharded hashtable
+    ShardHTShard_t *shards;     // Dynamic array of shards
+    size_t shard_count;         // always a power of 2
+    unsigned int shard_shift;   // bits dropped from a mixed hash to get its
+                                // shard index
+    size_t (*hash)(const void *);
+} ShardHashTable_t;
+
+/**
+ * @brief
+ *  Creates a sharded hashtable. The shards are robinhood hashtables that
+ *  rehash all at once, as a find must not modify a shard under a read lock.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] shard_count       number of shards, rounded up to a power of 2;
+ *                              a few times the number of threads works well
+ * @param[in] bucket_count      initial number of buckets of each shard
+ * @param[in] max_load_prop     load proportion to rehash a shard at; 0-1;
+ *                              0 if no rehash wanted
+ * @param[in] indexing          how hashes are reduced to bucket indices
+ * @param[in] hash_func         function to hash keys
+ * @param[in] comp_key          function to compare the keys
+ *
+ * @return Pointer to the new hashtable, NULL if unable to allocate memory.
+ */
+extern ShardHashTable_t *
+ShardHashTableCreate(size_t shard_count, size_t bucket_count,
+                     float max_load_prop, HTIndexing_t indexing,
+                     size_t (*hash_func)(const void *),
+                     int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a sharded hashtable and frees it's contents if provided with a
+ *  function do so. Must not be called while other threads use the table.
+ *
+ * @param[in,out] p_table       hashtable to delete
+ * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ */
+extern void ShardHashTableClear(ShardHashTable_t **p_table,
+                                void (*free_data)(void *),
+                                void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Adds a new key-value pair to a sharded hashtable, holding the write lock
+ *  of the key's shard only.
+ *
+ * @param[in,out] table         hashtable to add to
+ * @param[in]     key           key of the new item
+ * @param[in]     data          data of the new item
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : memory allocation falied, or the shard is full and automatic
+ *          rehashing is disabled @n
+ */
+extern bool ShardHashTableAdd(ShardHashTable_t *table, void *key, void *data);
+
+/**
+ * @brief
+ *  Removes a key-value pair from a sharded hashtable, holding the write lock
+ *  of the key's shard only, and frees it's key if provided with a function
+ *  do so. The data is returned rather than freed, so the caller owns it.
+ *
+ * @param[in,out] table         hashtable to remove from
+ * @param[in]     key           key of the item to remove
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return Pointer the data of the removed item, NULL if not found.
+ */
+extern void *ShardHashTableRemove(ShardHashTable_t *table, void *key,
+                                  void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Finds the data given the key in a sharded hashtable, holding the read
+ *  lock of the key's shard only. The data itself isn't guarded; the caller
+ *  must make sure no other thread removes and frees it while in use.
+ *
+ * @param[in] table         hashtable to search
+ * @param[in] key           key of the data
+ *
+ * @return Data corresponding to the key, NULL if not found.
+ */
+extern void *ShardHashTableFind(ShardHashTable_t *table, void *key);
+#endif
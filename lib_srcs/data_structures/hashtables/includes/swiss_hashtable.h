@@ -0,0 +1,146 @@
+/**
+ * @file swiss_hashtable.h
+ *
+ * @brief
+ *  Structs and functions for swiss open address hashtables. The buckets are
+ *  probed in groups of SWISS_HT_GROUP_WIDTH using one control byte per bucket
+ *  holding 7 bits of the key's hash, which are matched a whole group at a time
+ *  (with SSE2 when available). Hashes are always mixed with mixHash, as the
+ *  slot count is a power of 2.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef SWISS_HASHTABLE_H
+#define SWISS_HASHTABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SWISS_HT_GROUP_WIDTH 16 // number of control bytes matched at once
+
+typedef struct SwissHTSlot { // swiss open address hashtable slot
+    void *key;               // Pointer to the key
+    void *data;              // Pointer to the data
+} SwissHTSlot_t;
+
+typedef struct SwissHashTable { // swiss open address hashtable
+    /**
+     *  Control byte of each slot, followed by a copy of the first
+     *  SWISS_HT_GROUP_WIDTH control bytes so a group can be read past the
+     *  end. Holds 7 bits of the hash for a used slot, or a negative marker
+     *  for an empty or deleted one.
+     */
+    signed char *ctrls;
+    SwissHTSlot_t *slots; // Dynamic array of slots stored inline
+    struct {
+        size_t max;     // always a power of 2
+        size_t used;
+        size_t deleted; // slots marked as deleted, reclaimed on rehash
+    } count;        // tracks the total amount of slots and the amount used
+    float max_load; // limit proportion of load when rehashing should occur;
+                    // 0 to disable the automatic rehashing
+    size_t (*hash)(const void *);
+    /**
+     *  The compare function must operate as follows: @n
+     *  1) Returns int < 0 if key_1 should come before key_2 @n
+     *  2) Returns int >= 0 if key_1 should come after key_2 @n
+     */
+    int (*comp_key)(const void *, const void *);
+} SwissHashTable_t;
+
+/**
+ * @brief
+ *  Creates a swiss open address hashtable.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if key_1 should come before key_2 @n
+ *  2) Returns int >= 0 if key_1 should come after key_2 @n
+ *
+ * @param[in] bucket_count      initial number of slots, rounded up to a power
+ *                              of 2 no less than SWISS_HT_GROUP_WIDTH
+ * @param[in] max_load_prop     load proportion to rehash at; 0-1;
+ *                              0 if no rehash wanted
+ * @param[in] hash_func         function to hash keys
+ * @param[in] comp_key          function to compare the keys
+ *
+ * @return Pointer to the new hashtable, NULL if unable to allocate memory.
+ */
+extern SwissHashTable_t *
+SwissHashTableCreate(size_t bucket_count, float max_load_prop,
+                     size_t (*hash_func)(const void *),
+                     int (*comp_key)(const void *, const void *));
+
+/**
+ * @brief
+ *  Deletes a swiss open address hashtable and frees it's contents if provided
+ *  with a function do so.
+ *
+ * @param[in,out] p_table       hashtable to delete
+ * @param[in]     free_data     function to free data; NULL if not needed
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ */
+extern void SwissHashTableClear(SwissHashTable_t **p_table,
+                                void (*free_data)(void *),
+                                void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Adds a new key-value pair to a swiss open address hashtable.
+ *  Rehashes if the max load limit has been reached by doubling the current
+ *  number of slots, or by rebuilding in place when most of the load is
+ *  deleted slots.
+ *
+ * @param[in,out] table         hashtable to add to
+ * @param[in]     key           key of the new item
+ * @param[in]     data          data of the new item
+ *
+ * @return
+ *  true  : added successfully @n
+ *  false : memory allocation falied, or the table is full and automatic
+ *          rehashing is disabled @n
+ */
+extern bool SwissHashTableAdd(SwissHashTable_t *table, void *key, void *data);
+
+/**
+ * @brief
+ *  Removes a key-value pair from a swiss open address hashtable
+ *  and frees it's key if provided with a function do so. The data is
+ *  returned rather than freed, so the caller owns it.
+ *
+ * @param[in,out] table         hashtable to remove from
+ * @param[in]     key           key of the item to remove
+ * @param[in]     free_key      function to free keys; NULL if not needed
+ *
+ * @return Pointer the data of the removed item, NULL if not found.
+ */
+extern void *SwissHashTableRemove(SwissHashTable_t *table, void *key,
+                                  void (*free_key)(void *));
+
+/**
+ * @brief
+ *  Finds the data given the key in a swiss open address hashtable.
+ *
+ * @param[in] table         hashtable to search
+ * @param[in] key           key of the data
+ *
+ * @return Data corresponding to the key, NULL if not found.
+ */
+extern void *SwissHashTableFind(SwissHashTable_t *table, void *key);
+
+/**
+ * @brief
+ *  Rehashes a swiss open address hashtable, dropping all deleted slots.
+ *
+ * @param[in,out] table         hashtable to rehash
+ * @param[in]     new_count     new number of slots, rounded up to a power of 2
+ *
+ * @return
+ *   1 : rehashed successfully @n
+ *   0 : unable to allocate memory @n
+ *  -1 : new count can't hold the used slots under the max load @n
+ */
+extern int SwissHashTableRehash(SwissHashTable_t *table, size_t new_count);
+#endif
@@ -0,0 +1,267 @@
+/**
+ * @file chained_hashset.c
+ *
+ * @brief
+ *  Structs and functions for chained hashsets.
+ *
+ * @implements
+ *  chained_hashset.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "chained_hashset.h"
+#include <assert.h>
+#include <stdlib.h>
+
+static ChainHSNode_t **_findNode(const ChainHashSet_t *set, const void *key);
+static size_t _removeIf(ChainHashSet_t *set, const ChainHashSet_t *other,
+                        bool is_in_other, void (*free_key)(void *));
+static void _shrink(ChainHashSet_t *set);
+
+ChainHashSet_t *
+ChainHashSetCreate(size_t bucket_count, float max_load_prop,
+                   float min_load_prop, HTIndexing_t indexing,
+                   size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+    assert(min_load_prop == 0 || max_load_prop == 0
+           || min_load_prop < max_load_prop / 2);
+
+    ChainHashSet_t *set = malloc(sizeof(ChainHashSet_t));
+    if (set == NULL) {
+        return NULL;
+    }
+    bucket_count = HTIndexingRound(indexing, bucket_count);
+    set->buckets = calloc(bucket_count, sizeof(ChainHSNode_t *));
+    if (set->buckets == NULL) {
+        free(set);
+        return NULL;
+    }
+    set->length = bucket_count;
+    set->count = 0;
+    set->max_load = max_load_prop;
+    set->min_load = min_load_prop;
+    set->indexing = indexing;
+    set->hash = hash_func;
+    set->comp_key = comp_key;
+    return set;
+}
+
+void ChainHashSetClear(ChainHashSet_t **p_set, void (*free_key)(void *))
+{
+    assert(p_set != NULL);
+    assert(*p_set != NULL);
+
+    ChainHashSet_t *set = *p_set;
+    for (size_t i = 0; i < set->length; i++) {
+        ChainHSNode_t *curr = set->buckets[i];
+        while (curr != NULL) {
+            ChainHSNode_t *next = curr->next;
+            if (free_key != NULL) {
+                free_key(curr->key);
+            }
+            free(curr);
+            curr = next;
+        }
+    }
+    free(set->buckets);
+    free(set);
+    *p_set = NULL;
+}
+
+int ChainHashSetAdd(ChainHashSet_t *set, void *key)
+{
+    assert(set != NULL);
+
+    if (*_findNode(set, key) != NULL) {
+        return 0;
+    }
+    ChainHSNode_t *new_node = malloc(sizeof(ChainHSNode_t));
+    if (new_node == NULL) {
+        return -1;
+    }
+    if (set->max_load != 0
+        && (float)(set->count + 1) / set->length > set->max_load) {
+        ChainHashSetRehash(set, 2 * set->length);
+    }
+    size_t idx = HTIndexingReduce(set->indexing, set->hash(key), set->length);
+    new_node->key = key;
+    new_node->next = set->buckets[idx];
+    set->buckets[idx] = new_node;
+    set->count += 1;
+    return 1;
+}
+
+bool ChainHashSetRemove(ChainHashSet_t *set, const void *key,
+                        void (*free_key)(void *))
+{
+    assert(set != NULL);
+
+    ChainHSNode_t **p_node = _findNode(set, key);
+    if (*p_node == NULL) {
+        return false;
+    }
+    ChainHSNode_t *node = *p_node;
+    *p_node = node->next;
+    if (free_key != NULL) {
+        free_key(node->key);
+    }
+    free(node);
+    set->count -= 1;
+    _shrink(set);
+    return true;
+}
+
+bool ChainHashSetContains(const ChainHashSet_t *set, const void *key)
+{
+    assert(set != NULL);
+
+    return *_findNode(set, key) != NULL;
+}
+
+bool ChainHashSetRehash(ChainHashSet_t *set, size_t new_count)
+{
+    assert(set != NULL);
+
+    new_count = HTIndexingRound(set->indexing, new_count);
+    ChainHSNode_t **new_buckets = calloc(new_count, sizeof(ChainHSNode_t *));
+    if (new_buckets == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < set->length; i++) {
+        ChainHSNode_t *curr = set->buckets[i];
+        while (curr != NULL) {
+            ChainHSNode_t *next = curr->next;
+            size_t idx
+                = HTIndexingReduce(set->indexing, set->hash(curr->key),
+                                   new_count);
+            curr->next = new_buckets[idx];
+            new_buckets[idx] = curr;
+            curr = next;
+        }
+    }
+    free(set->buckets);
+    set->buckets = new_buckets;
+    set->length = new_count;
+    return true;
+}
+
+bool ChainHashSetUnion(ChainHashSet_t *set, const ChainHashSet_t *other)
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    if (set == other) {
+        return true;
+    }
+    if (set->max_load != 0) {
+        size_t new_count = set->length;
+        while ((float)(set->count + other->count) / new_count
+               > set->max_load) {
+            new_count *= 2;
+        }
+        if (new_count != set->length) {
+            ChainHashSetRehash(set, new_count);
+        }
+    }
+    for (size_t i = 0; i < other->length; i++) {
+        for (ChainHSNode_t *curr = other->buckets[i]; curr != NULL;
+             curr = curr->next) {
+            if (ChainHashSetAdd(set, curr->key) == -1) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+size_t ChainHashSetIntersect(ChainHashSet_t *set, const ChainHashSet_t *other,
+                             void (*free_key)(void *))
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    if (set == other) {
+        return 0;
+    }
+    return _removeIf(set, other, false, free_key);
+}
+
+size_t ChainHashSetDifference(ChainHashSet_t *set, const ChainHashSet_t *other,
+                              void (*free_key)(void *))
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    return _removeIf(set, other, true, free_key);
+}
+
+/**
+ * @brief
+ *  Finds the link pointing to the node holding a key, or to the NULL at the
+ *  end of its bucket if the key isn't in the set.
+ */
+static ChainHSNode_t **_findNode(const ChainHashSet_t *set, const void *key)
+{
+    size_t idx = HTIndexingReduce(set->indexing, set->hash(key), set->length);
+    ChainHSNode_t **p_node = &set->buckets[idx];
+    while (*p_node != NULL && set->comp_key((*p_node)->key, key) != 0) {
+        p_node = &(*p_node)->next;
+    }
+    return p_node;
+}
+
+/**
+ * @brief
+ *  Removes the keys whose membership of other is is_in_other, unlinking
+ *  them as each bucket is walked, then shrinks the buckets once.
+ */
+static size_t _removeIf(ChainHashSet_t *set, const ChainHashSet_t *other,
+                        bool is_in_other, void (*free_key)(void *))
+{
+    size_t removed = 0;
+    for (size_t i = 0; i < set->length; i++) {
+        ChainHSNode_t **p_node = &set->buckets[i];
+        while (*p_node != NULL) {
+            ChainHSNode_t *node = *p_node;
+            // a set holds all its own keys, even the ones already unlinked
+            if ((set == other || ChainHashSetContains(other, node->key))
+                != is_in_other) {
+                p_node = &node->next;
+                continue;
+            }
+            *p_node = node->next;
+            if (free_key != NULL) {
+                free_key(node->key);
+            }
+            free(node);
+            removed += 1;
+        }
+    }
+    set->count -= removed;
+    _shrink(set);
+    return removed;
+}
+
+/**
+ * @brief
+ *  Halves the buckets as many times as needed to bring the load back up to
+ *  the min load, in a single rehash.
+ */
+static void _shrink(ChainHashSet_t *set)
+{
+    if (set->min_load == 0) {
+        return;
+    }
+    size_t new_count = set->length;
+    while (new_count > 1 && (float)set->count / new_count < set->min_load) {
+        new_count /= 2;
+    }
+    if (new_count != set->length) {
+        ChainHashSetRehash(set, new_count);
+    }
+}
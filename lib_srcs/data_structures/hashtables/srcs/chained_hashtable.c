@@ -15,24 +15,48 @@
 #include "linked_list_kvp.h"
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
+
+static ChainHashTable_t *_create(size_t bucket_count, float max_load_prop,
+                                 float min_load_prop, HTIndexing_t indexing,
+                                 int (*comp_key)(const void *, const void *));
+static size_t _hashKey(const ChainHashTable_t *table, const void *key);
+static size_t _bucketIdx(ChainHashTable_t *table, const void *key);
+static void *_findInBucket(ChainHashTable_t *table, LListKVP_t *bucket,
+                           const void *key);
 
 ChainHashTable_t *
-ChainHashTableCreate(size_t bucket_count, size_t (*hash_func)(const void *),
+ChainHashTableCreate(size_t bucket_count, float max_load_prop,
+                     float min_load_prop, HTIndexing_t indexing,
+                     size_t (*hash_func)(const void *),
                      int (*comp_key)(const void *, const void *))
 {
     assert(hash_func != NULL);
+    assert(comp_key != NULL);
 
-    ChainHashTable_t *table = calloc(1, sizeof(ChainHashTable_t));
-    if (table == NULL) {
-        return NULL;
+    ChainHashTable_t *table = _create(bucket_count, max_load_prop,
+                                      min_load_prop, indexing, comp_key);
+    if (table != NULL) {
+        table->hash = hash_func;
     }
-    table->buckets = LListKVPCreate(comp_key);
-    if (table->buckets == NULL) {
-        free(table);
-        return NULL;
+    return table;
+}
+
+ChainHashTable_t *
+ChainHashTableCreateSeeded(size_t bucket_count, float max_load_prop,
+                           float min_load_prop, HTIndexing_t indexing,
+                           size_t (*hash_func)(const void *, size_t),
+                           int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    ChainHashTable_t *table = _create(bucket_count, max_load_prop,
+                                      min_load_prop, indexing, comp_key);
+    if (table != NULL) {
+        table->seeded_hash = hash_func;
+        table->seed = randomSeed();
     }
-    table->length = bucket_count;
-    table->hash = hash_func;
     return table;
 }
 
@@ -54,8 +78,16 @@ int ChainHashTableAdd(ChainHashTable_t *table, void *key, void *data)
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
-    return LListKVPAdd(&table->buckets[idx], key, data);
+    if (table->max_load != 0
+        && (float)(table->count + 1) / table->length > table->max_load) {
+        ChainHashTableRehash(table, 2 * table->length);
+    }
+    size_t idx = _bucketIdx(table, key);
+    if (!LListKVPAdd(&table->buckets[idx], key, data)) {
+        return 0;
+    }
+    table->count += 1;
+    return 1;
 }
 
 void *ChainHashTableRemove(ChainHashTable_t *table, void *key,
@@ -63,16 +95,51 @@ void *ChainHashTableRemove(ChainHashTable_t *table, void *key,
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
-    return LListKVPRemove(&table->buckets[idx], key, free_key);
+    LListKVP_t *bucket = &table->buckets[_bucketIdx(table, key)];
+    size_t prev_count = bucket->count;
+    void *data = LListKVPRemove(bucket, key, free_key);
+    if (bucket->count == prev_count) {
+        return data;
+    }
+    table->count -= 1;
+    if (table->min_load != 0 && table->length > 1
+        && (float)table->count / table->length < table->min_load) {
+        ChainHashTableRehash(table, table->length / 2);
+    }
+    return data;
 }
 
 void *ChainHashTableFind(ChainHashTable_t *table, const void *key)
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
-    return LListKVPFind(&table->buckets[idx], key);
+    size_t idx = _bucketIdx(table, key);
+    return _findInBucket(table, &table->buckets[idx], key);
+}
+
+void ChainHashTableFindBatch(ChainHashTable_t *table, void **keys,
+                             size_t key_count, void **results)
+{
+    assert(table != NULL);
+
+    size_t idxs[HT_FIND_BATCH];
+    for (size_t start = 0; start < key_count; start += HT_FIND_BATCH) {
+        size_t batch = key_count - start;
+        if (batch > HT_FIND_BATCH) {
+            batch = HT_FIND_BATCH;
+        }
+        for (size_t k = 0; k < batch; k++) {
+            idxs[k] = _bucketIdx(table, keys[start + k]);
+            HT_PREFETCH(&table->buckets[idxs[k]]);
+        }
+        for (size_t k = 0; k < batch; k++) {
+            HT_PREFETCH(table->buckets[idxs[k]].head);
+        }
+        for (size_t k = 0; k < batch; k++) {
+            results[start + k] = _findInBucket(
+                table, &table->buckets[idxs[k]], keys[start + k]);
+        }
+    }
 }
 
 bool ChainHashTableFindAll(ChainHashTable_t *table, const void *key,
@@ -80,7 +147,7 @@ bool ChainHashTableFindAll(ChainHashTable_t *table, const void *key,
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
+    size_t idx = _bucketIdx(table, key);
     return LListKVPFindAll(&table->buckets[idx], key, ptr_arr, count);
 }
 
@@ -88,7 +155,7 @@ int ChainHashTableCountRepeats(ChainHashTable_t *table, const void *key)
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
+    size_t idx = _bucketIdx(table, key);
     return LListKVPCountRepeats(&table->buckets[idx], key);
 }
 
@@ -103,10 +170,199 @@ void ChainHashTableTraverse(ChainHashTable_t *table,
     }
 }
 
+void ChainHashTableIterBegin(const ChainHashTable_t *table,
+                             ChainHTIter_t *iter)
+{
+    assert(table != NULL);
+    assert(iter != NULL);
+
+    memset(iter, 0, sizeof(ChainHTIter_t));
+}
+
+bool ChainHashTableIterNext(const ChainHashTable_t *table, ChainHTIter_t *iter)
+{
+    assert(table != NULL);
+    assert(iter != NULL);
+
+    if (iter->node != NULL) {
+        iter->node = iter->node->next;
+    }
+    while (iter->node == NULL) {
+        if (iter->bucket >= table->length) {
+            return false;
+        }
+        iter->node = table->buckets[iter->bucket].head;
+        iter->bucket += 1;
+    }
+    iter->key = iter->node->key;
+    iter->data = iter->node->data;
+    return true;
+}
+
+size_t ChainHashTableScan(ChainHashTable_t *table, size_t cursor, size_t step,
+                          void (*func)(void *, void *, void *), void *arg)
+{
+    assert(table != NULL);
+    assert(func != NULL);
+
+    size_t mask = table->length - 1;
+    do {
+        size_t i = cursor;
+        if (table->indexing == HT_INDEX_MASK) {
+            i = cursor & mask;
+            cursor = HTScanNext(cursor, mask);
+        } else {
+            cursor += 1;
+            if (cursor >= table->length) {
+                cursor = 0;
+            }
+        }
+        if (i >= table->length) {
+            continue;
+        }
+        for (LListKVPNode_t *node = table->buckets[i].head; node != NULL;
+             node = node->next) {
+            func(node->key, node->data, arg);
+        }
+    } while (step-- > 1 && cursor != 0);
+    return cursor;
+}
+
 int ChainHashTableChainLength(ChainHashTable_t *table, const void *key)
 {
     assert(table != NULL);
 
-    size_t idx = table->hash(key) % table->length;
+    size_t idx = _bucketIdx(table, key);
     return table->buckets[idx].count;
 }
+
+bool ChainHashTableRehash(ChainHashTable_t *table, size_t new_count)
+{
+    assert(table != NULL);
+
+    double start = HTStatsNow();
+    new_count = HTIndexingRound(table->indexing, new_count);
+    LListKVP_t *new_buckets = calloc(new_count, sizeof(LListKVP_t));
+    if (new_buckets == NULL) {
+        return false;
+    }
+    int (*comp_key)(const void *, const void *) = table->buckets[0].comp_key;
+    for (size_t i = 0; i < new_count; i++) {
+        new_buckets[i].comp_key = comp_key;
+    }
+    for (size_t i = 0; i < table->length; i++) {
+        LListKVPNode_t *curr = table->buckets[i].head;
+        while (curr != NULL) {
+            LListKVPNode_t *next = curr->next;
+            size_t idx = HTIndexingReduce(
+                table->indexing, _hashKey(table, curr->key), new_count);
+            LListKVPAddNode(&new_buckets[idx], curr);
+            curr = next;
+        }
+    }
+    free(table->buckets);
+    table->buckets = new_buckets;
+    table->length = new_count;
+    table->rehashes.count += 1;
+    table->rehashes.secs += HTStatsNow() - start;
+    return true;
+}
+
+void ChainHashTableStats(const ChainHashTable_t *table, HTStats_t *stats)
+{
+    assert(table != NULL);
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(HTStats_t));
+    stats->entries = table->count;
+    stats->buckets = table->length;
+    stats->load = (double)stats->entries / stats->buckets;
+    size_t probe_sum = 0;
+    for (size_t i = 0; i < table->length; i++) {
+        size_t length = table->buckets[i].count;
+        HTStatsAddBin(stats->histogram, length, 1);
+        probe_sum += length * (length + 1) / 2; // finding the n-th node looks
+                                                // at n nodes
+        if (length > stats->max_probe) {
+            stats->max_probe = length;
+        }
+    }
+    if (stats->entries != 0) {
+        stats->mean_probe = (double)probe_sum / stats->entries;
+    }
+    stats->rehashes = table->rehashes;
+#ifdef HT_STATS
+    stats->counters = table->counters;
+#endif
+}
+
+/**
+ * @brief
+ *  Allocates a table with everything but its hash function set.
+ */
+static ChainHashTable_t *_create(size_t bucket_count, float max_load_prop,
+                                 float min_load_prop, HTIndexing_t indexing,
+                                 int (*comp_key)(const void *, const void *))
+{
+    // at half of max_load or more, halving the buckets on a remove would
+    // push the load past max_load and the next add would double them back
+    assert(min_load_prop == 0 || max_load_prop == 0
+           || min_load_prop < max_load_prop / 2);
+
+    ChainHashTable_t *table = calloc(1, sizeof(ChainHashTable_t));
+    if (table == NULL) {
+        return NULL;
+    }
+    bucket_count = HTIndexingRound(indexing, bucket_count);
+    table->buckets = calloc(bucket_count, sizeof(LListKVP_t));
+    if (table->buckets == NULL) {
+        free(table);
+        return NULL;
+    }
+    for (size_t i = 0; i < bucket_count; i++) {
+        table->buckets[i].comp_key = comp_key;
+    }
+    table->length = bucket_count;
+    table->max_load = max_load_prop;
+    table->min_load = min_load_prop;
+    table->indexing = indexing;
+    return table;
+}
+
+/**
+ * @brief
+ *  Hashes a key with the table's seeded hash if it has one.
+ */
+static size_t _hashKey(const ChainHashTable_t *table, const void *key)
+{
+    if (table->seeded_hash != NULL) {
+        return table->seeded_hash(key, table->seed);
+    }
+    return table->hash(key);
+}
+
+static size_t _bucketIdx(ChainHashTable_t *table, const void *key)
+{
+    return HTIndexingReduce(table->indexing, _hashKey(table, key),
+                            table->length);
+}
+
+/**
+ * @brief
+ *  Finds the data of the first node with a matching key in a bucket, as
+ *  LListKVPFind does, counting the nodes looked at.
+ */
+static void *_findInBucket(ChainHashTable_t *table, LListKVP_t *bucket,
+                           const void *key)
+{
+    HT_COUNT(table, lookups, 1);
+    for (LListKVPNode_t *curr = bucket->head; curr != NULL;
+         curr = curr->next) {
+        HT_COUNT(table, probes, 1);
+        HT_COUNT(table, compares, 1);
+        if (bucket->comp_key(curr->key, key) == 0) {
+            return curr->data;
+        }
+    }
+    return NULL;
+}
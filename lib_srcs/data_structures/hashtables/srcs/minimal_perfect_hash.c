@@ -0,0 +1,248 @@
+/**
+ * @file minimal_perfect_hash.c
+ *
+ * @brief
+ *  Structs and functions for minimal perfect hash functions and read-only
+ *  maps built on them.
+ *
+ * @implements
+ *  minimal_perfect_hash.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "minimal_perfect_hash.h"
+#include "hashtable_index.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BIT_IS_SET(bits, i) (((bits)[(i) / 64] >> ((i) % 64)) & 1)
+#define BIT_SET(bits, i) ((bits)[(i) / 64] |= (uint64_t)1 << ((i) % 64))
+
+static bool _addLevel(MinPerfHash_t *hash, const void **keys,
+                      size_t *p_key_count, float gamma);
+static bool _rankBits(MinPerfHash_t *hash);
+static size_t _popCount(uint64_t word);
+
+MinPerfHash_t *MinPerfHashCreate(const PointerArray_t *keys, float gamma,
+                                 size_t (*hash_func)(const void *, size_t))
+{
+    assert(keys != NULL);
+    assert(hash_func != NULL);
+
+    MinPerfHash_t *new_hash = calloc(1, sizeof(MinPerfHash_t));
+    // keys left for the next level, overwritten in place by each level
+    const void **left = malloc((keys->len + 1) * sizeof(void *));
+    if (new_hash == NULL || left == NULL) {
+        free(new_hash);
+        free(left);
+        return NULL;
+    }
+    memcpy(left, keys->ptrs, keys->len * sizeof(void *));
+    new_hash->count = keys->len;
+    new_hash->hash = hash_func;
+    if (gamma < 1) {
+        gamma = 1;
+    }
+    size_t left_count = keys->len;
+    bool is_built = true;
+    while (left_count > 0 && is_built) {
+        is_built = new_hash->level_count < MIN_PERF_HASH_MAX_LEVELS
+                   && _addLevel(new_hash, left, &left_count, gamma);
+    }
+    free(left);
+    if (!is_built || !_rankBits(new_hash)) {
+        MinPerfHashClear(&new_hash);
+        return NULL;
+    }
+    return new_hash;
+}
+
+void MinPerfHashClear(MinPerfHash_t **p_hash)
+{
+    assert(p_hash != NULL);
+    assert(*p_hash != NULL);
+
+    free((*p_hash)->bits);
+    free((*p_hash)->ranks);
+    free(*p_hash);
+    *p_hash = NULL;
+}
+
+size_t MinPerfHashIndex(const MinPerfHash_t *hash, const void *key)
+{
+    assert(hash != NULL);
+
+    for (size_t level = 0; level < hash->level_count; level++) {
+        size_t offset = hash->level_offsets[level];
+        size_t size = hash->level_offsets[level + 1] - offset;
+        size_t i = offset
+                   + HTIndexingReduce(HT_INDEX_MULSHIFT,
+                                      hash->hash(key, level), size);
+        if (BIT_IS_SET(hash->bits, i)) {
+            size_t word = i / 64;
+            size_t rank = hash->ranks[word / MIN_PERF_HASH_RANK_WORDS];
+            for (size_t w = word - word % MIN_PERF_HASH_RANK_WORDS; w < word;
+                 w++) {
+                rank += _popCount(hash->bits[w]);
+            }
+            uint64_t below = ((uint64_t)1 << (i % 64)) - 1;
+            return rank + _popCount(hash->bits[word] & below);
+        }
+    }
+    return SIZE_MAX;
+}
+
+MinPerfHashMap_t *
+MinPerfHashMapCreate(const PointerArray_t *keys, const PointerArray_t *data,
+                     float gamma, size_t (*hash_func)(const void *, size_t),
+                     int (*comp_key)(const void *, const void *))
+{
+    assert(keys != NULL);
+    assert(data == NULL || data->len == keys->len);
+    assert(comp_key != NULL);
+
+    MinPerfHashMap_t *new_map = calloc(1, sizeof(MinPerfHashMap_t));
+    if (new_map == NULL) {
+        return NULL;
+    }
+    new_map->comp_key = comp_key;
+    new_map->hash = MinPerfHashCreate(keys, gamma, hash_func);
+    new_map->keys = malloc((keys->len + 1) * sizeof(void *));
+    if (data != NULL) {
+        new_map->data = malloc((keys->len + 1) * sizeof(void *));
+    }
+    if (new_map->hash == NULL || new_map->keys == NULL
+        || (data != NULL && new_map->data == NULL)) {
+        MinPerfHashMapClear(&new_map);
+        return NULL;
+    }
+    for (size_t i = 0; i < keys->len; i++) {
+        size_t idx = MinPerfHashIndex(new_map->hash, keys->ptrs[i]);
+        new_map->keys[idx] = keys->ptrs[i];
+        if (data != NULL) {
+            new_map->data[idx] = data->ptrs[i];
+        }
+    }
+    return new_map;
+}
+
+void MinPerfHashMapClear(MinPerfHashMap_t **p_map)
+{
+    assert(p_map != NULL);
+    assert(*p_map != NULL);
+
+    if ((*p_map)->hash != NULL) {
+        MinPerfHashClear(&(*p_map)->hash);
+    }
+    free((*p_map)->keys);
+    free((*p_map)->data);
+    free(*p_map);
+    *p_map = NULL;
+}
+
+void *MinPerfHashMapFind(const MinPerfHashMap_t *map, const void *key)
+{
+    assert(map != NULL);
+
+    size_t idx = MinPerfHashIndex(map->hash, key);
+    if (idx >= map->hash->count || map->comp_key(map->keys[idx], key) != 0) {
+        return NULL;
+    }
+    return (map->data != NULL) ? map->data[idx] : map->keys[idx];
+}
+
+/**
+ * @brief
+ *  Hashes the keys left into a new level, setting the bits of the keys that
+ *  land alone and keeping the keys that collide for the next level.
+ */
+static bool _addLevel(MinPerfHash_t *hash, const void **keys,
+                      size_t *p_key_count, float gamma)
+{
+    size_t level = hash->level_count;
+    size_t offset = hash->level_offsets[level];
+    size_t words = ((size_t)(gamma * *p_key_count) + 63) / 64;
+    size_t size = words * 64;
+    uint64_t *bits
+        = realloc(hash->bits, (offset / 64 + words) * sizeof(uint64_t));
+    uint64_t *collisions = calloc(words, sizeof(uint64_t));
+    if (bits == NULL || collisions == NULL) {
+        if (bits != NULL) {
+            hash->bits = bits;
+        }
+        free(collisions);
+        return false;
+    }
+    hash->bits = bits;
+    uint64_t *level_bits = bits + offset / 64;
+    memset(level_bits, 0, words * sizeof(uint64_t));
+    for (size_t k = 0; k < *p_key_count; k++) {
+        size_t i = HTIndexingReduce(HT_INDEX_MULSHIFT,
+                                    hash->hash(keys[k], level), size);
+        if (BIT_IS_SET(level_bits, i)) {
+            BIT_SET(collisions, i);
+        } else {
+            BIT_SET(level_bits, i);
+        }
+    }
+    size_t left_count = 0;
+    for (size_t k = 0; k < *p_key_count; k++) {
+        size_t i = HTIndexingReduce(HT_INDEX_MULSHIFT,
+                                    hash->hash(keys[k], level), size);
+        if (BIT_IS_SET(collisions, i)) {
+            keys[left_count++] = keys[k];
+        }
+    }
+    for (size_t w = 0; w < words; w++) {
+        level_bits[w] &= ~collisions[w];
+    }
+    free(collisions);
+    *p_key_count = left_count;
+    hash->level_offsets[level + 1] = offset + size;
+    hash->level_count += 1;
+    return true;
+}
+
+/**
+ * @brief
+ *  Stores the number of set bits before every MIN_PERF_HASH_RANK_WORDS words
+ *  of the levels.
+ */
+static bool _rankBits(MinPerfHash_t *hash)
+{
+    size_t words = hash->level_offsets[hash->level_count] / 64;
+    size_t rank_count = words / MIN_PERF_HASH_RANK_WORDS + 1;
+    hash->ranks = malloc(rank_count * sizeof(uint64_t));
+    if (hash->ranks == NULL) {
+        return false;
+    }
+    uint64_t rank = 0;
+    for (size_t w = 0; w < words; w++) {
+        if (w % MIN_PERF_HASH_RANK_WORDS == 0) {
+            hash->ranks[w / MIN_PERF_HASH_RANK_WORDS] = rank;
+        }
+        rank += _popCount(hash->bits[w]);
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *  Counts the set bits of a word.
+ */
+static size_t _popCount(uint64_t word)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    size_t count = 0;
+    for (; word != 0; word &= word - 1) {
+        count++;
+    }
+    return count;
+#endif
+}
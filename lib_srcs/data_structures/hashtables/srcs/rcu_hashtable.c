@@ -0,0 +1,376 @@
+/**
+ * @file rcu_hashtable.c
+ *
+ * @brief
+ *  Structs and functions for read-copy-update hashtables.
+ *
+ * @implements
+ *  rcu_hashtable.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "rcu_hashtable.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static RcuHTArray_t *_allocArray(size_t count);
+static void _freeArray(void *array);
+static void _clearArray(RcuHTArray_t *array, void (*free_data)(void *),
+                        void (*free_key)(void *));
+static bool _rehash(RcuHashTable_t *table, size_t new_count);
+static void _retire(RcuHashTable_t *table, void *ptr,
+                    void (*free_ptr)(void *));
+static void _reclaim(RcuHashTable_t *table);
+
+RcuHashTable_t *
+RcuHashTableCreate(size_t bucket_count, float max_load_prop,
+                   HTIndexing_t indexing, size_t reader_count,
+                   size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    RcuHashTable_t *new_table = malloc(sizeof(RcuHashTable_t));
+    if (new_table == NULL) {
+        return NULL;
+    }
+    if (bucket_count == 0) {
+        bucket_count = 1;
+    }
+    RcuHTArray_t *array = _allocArray(HTIndexingRound(indexing, bucket_count));
+    new_table->readers
+        = aligned_alloc(RCU_HT_ALIGN, reader_count * sizeof(RcuHTReader_t));
+    if (array == NULL || new_table->readers == NULL
+        || pthread_mutex_init(&new_table->lock, NULL) != 0) {
+        free(array);
+        free(new_table->readers);
+        free(new_table);
+        return NULL;
+    }
+    for (size_t i = 0; i < reader_count; i++) {
+        atomic_init(&new_table->readers[i].epoch, 0);
+        new_table->readers[i].is_used = false;
+    }
+    atomic_init(&new_table->array, array);
+    atomic_init(&new_table->epoch, 1);
+    new_table->reader_count = reader_count;
+    new_table->retired = NULL;
+    new_table->count = 0;
+    new_table->indexing = indexing;
+    new_table->max_load = max_load_prop;
+    new_table->hash = hash_func;
+    new_table->comp_key = comp_key;
+    return new_table;
+}
+
+void RcuHashTableClear(RcuHashTable_t **p_table, void (*free_data)(void *),
+                       void (*free_key)(void *))
+{
+    assert(p_table != NULL);
+    assert(*p_table != NULL);
+
+    RcuHashTable_t *table = *p_table;
+    for (RcuHTRetired_t *retired = table->retired; retired != NULL;) {
+        RcuHTRetired_t *next = retired->next;
+        retired->free_ptr(retired->ptr);
+        free(retired);
+        retired = next;
+    }
+    RcuHTArray_t *array
+        = atomic_load_explicit(&table->array, memory_order_relaxed);
+    _clearArray(array, free_data, free_key);
+    pthread_mutex_destroy(&table->lock);
+    free(table->readers);
+    free(table);
+    *p_table = NULL;
+}
+
+RcuHTReader_t *RcuHashTableJoin(RcuHashTable_t *table)
+{
+    assert(table != NULL);
+
+    RcuHTReader_t *reader = NULL;
+    pthread_mutex_lock(&table->lock);
+    for (size_t i = 0; i < table->reader_count; i++) {
+        if (!table->readers[i].is_used) {
+            reader = &table->readers[i];
+            reader->is_used = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&table->lock);
+    return reader;
+}
+
+void RcuHashTableLeave(RcuHashTable_t *table, RcuHTReader_t *reader)
+{
+    assert(table != NULL);
+    assert(reader != NULL);
+
+    pthread_mutex_lock(&table->lock);
+    atomic_store_explicit(&reader->epoch, 0, memory_order_release);
+    reader->is_used = false;
+    pthread_mutex_unlock(&table->lock);
+}
+
+bool RcuHashTableAdd(RcuHashTable_t *table, void *key, void *data)
+{
+    assert(table != NULL);
+
+    RcuHTNode_t *new_node = malloc(sizeof(RcuHTNode_t));
+    if (new_node == NULL) {
+        return false;
+    }
+    new_node->key = key;
+    new_node->data = data;
+    new_node->hash = table->hash(key);
+
+    pthread_mutex_lock(&table->lock);
+    RcuHTArray_t *array
+        = atomic_load_explicit(&table->array, memory_order_relaxed);
+    if (table->max_load != 0
+        && (float)(table->count + 1) / array->count > table->max_load
+        && _rehash(table, 2 * array->count)) {
+        array = atomic_load_explicit(&table->array, memory_order_relaxed);
+    }
+    size_t i = HTIndexingReduce(table->indexing, new_node->hash, array->count);
+    atomic_init(&new_node->next, atomic_load_explicit(&array->heads[i],
+                                                      memory_order_relaxed));
+    // readers see the node only once it's fully written
+    atomic_store_explicit(&array->heads[i], new_node, memory_order_release);
+    table->count += 1;
+    pthread_mutex_unlock(&table->lock);
+    return true;
+}
+
+bool RcuHashTableRemove(RcuHashTable_t *table, void *key,
+                        void (*free_data)(void *), void (*free_key)(void *))
+{
+    assert(table != NULL);
+
+    bool is_removed = false;
+    size_t hash = table->hash(key);
+    pthread_mutex_lock(&table->lock);
+    RcuHTArray_t *array
+        = atomic_load_explicit(&table->array, memory_order_relaxed);
+    size_t i = HTIndexingReduce(table->indexing, hash, array->count);
+    RcuHTNode_t *_Atomic *link = &array->heads[i];
+    for (RcuHTNode_t *node = atomic_load_explicit(link, memory_order_relaxed);
+         node != NULL; node = atomic_load_explicit(link, memory_order_relaxed)) {
+        if (node->hash == hash && table->comp_key(node->key, key) == 0) {
+            is_removed = true;
+            // readers already on the node can still follow its next
+            atomic_store_explicit(
+                link, atomic_load_explicit(&node->next, memory_order_relaxed),
+                memory_order_release);
+            if (free_data != NULL) {
+                _retire(table, node->data, free_data);
+            }
+            if (free_key != NULL) {
+                _retire(table, node->key, free_key);
+            }
+            _retire(table, node, free);
+            table->count -= 1;
+            _reclaim(table);
+            break;
+        }
+        link = &node->next;
+    }
+    pthread_mutex_unlock(&table->lock);
+    return is_removed;
+}
+
+void *RcuHashTableFind(RcuHashTable_t *table, RcuHTReader_t *reader,
+                       void *key)
+{
+    assert(table != NULL);
+    assert(reader != NULL);
+
+    size_t hash = table->hash(key);
+    // announce the epoch before reading anything a writer could retire; the
+    // fence pairs with the one in _retire so either the writer sees the
+    // announcement, or this find sees the entry already unlinked
+    atomic_store_explicit(
+        &reader->epoch,
+        atomic_load_explicit(&table->epoch, memory_order_relaxed),
+        memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    void *data = NULL;
+    RcuHTArray_t *array
+        = atomic_load_explicit(&table->array, memory_order_acquire);
+    size_t i = HTIndexingReduce(table->indexing, hash, array->count);
+    for (RcuHTNode_t *node
+         = atomic_load_explicit(&array->heads[i], memory_order_acquire);
+         node != NULL;
+         node = atomic_load_explicit(&node->next, memory_order_acquire)) {
+        if (node->hash == hash && table->comp_key(node->key, key) == 0) {
+            data = node->data;
+            break;
+        }
+    }
+    atomic_store_explicit(&reader->epoch, 0, memory_order_release);
+    return data;
+}
+
+/**
+ * @brief
+ *  Allocates a bucket array with all buckets empty.
+ *
+ * @return Pointer to the new array, NULL if unable to allocate memory.
+ */
+static RcuHTArray_t *_allocArray(size_t count)
+{
+    RcuHTArray_t *array
+        = malloc(sizeof(RcuHTArray_t) + count * sizeof(RcuHTNode_t *));
+    if (array == NULL) {
+        return NULL;
+    }
+    array->count = count;
+    for (size_t i = 0; i < count; i++) {
+        atomic_init(&array->heads[i], NULL);
+    }
+    return array;
+}
+
+/**
+ * @brief
+ *  Frees a bucket array along with its entries, but not their keys or data.
+ */
+static void _freeArray(void *array)
+{
+    _clearArray(array, NULL, NULL);
+}
+
+static void _clearArray(RcuHTArray_t *array, void (*free_data)(void *),
+                        void (*free_key)(void *))
+{
+    for (size_t i = 0; i < array->count; i++) {
+        RcuHTNode_t *node
+            = atomic_load_explicit(&array->heads[i], memory_order_relaxed);
+        while (node != NULL) {
+            RcuHTNode_t *next
+                = atomic_load_explicit(&node->next, memory_order_relaxed);
+            if (free_data != NULL) {
+                free_data(node->data);
+            }
+            if (free_key != NULL) {
+                free_key(node->key);
+            }
+            free(node);
+            node = next;
+        }
+    }
+    free(array);
+}
+
+/**
+ * @brief
+ *  Publishes a copy of the entries in a new bucket array, and retires the
+ *  current one. Must hold the table's lock.
+ *
+ * @return
+ *  true  : rehashed successfully @n
+ *  false : unable to allocate memory, the table is left as it was @n
+ */
+static bool _rehash(RcuHashTable_t *table, size_t new_count)
+{
+    RcuHTArray_t *old_array
+        = atomic_load_explicit(&table->array, memory_order_relaxed);
+    RcuHTArray_t *new_array
+        = _allocArray(HTIndexingRound(table->indexing, new_count));
+    if (new_array == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < old_array->count; i++) {
+        for (RcuHTNode_t *node = atomic_load_explicit(&old_array->heads[i],
+                                                      memory_order_relaxed);
+             node != NULL;
+             node = atomic_load_explicit(&node->next, memory_order_relaxed)) {
+            RcuHTNode_t *copy = malloc(sizeof(RcuHTNode_t));
+            if (copy == NULL) {
+                _freeArray(new_array);
+                return false;
+            }
+            *copy = (RcuHTNode_t){
+                .key = node->key, .data = node->data, .hash = node->hash};
+            size_t new_i = HTIndexingReduce(table->indexing, copy->hash,
+                                            new_array->count);
+            atomic_init(&copy->next,
+                        atomic_load_explicit(&new_array->heads[new_i],
+                                             memory_order_relaxed));
+            atomic_init(&new_array->heads[new_i], copy);
+        }
+    }
+    atomic_store_explicit(&table->array, new_array, memory_order_release);
+    _retire(table, old_array, _freeArray);
+    _reclaim(table);
+    return true;
+}
+
+/**
+ * @brief
+ *  Retires a pointer no longer reachable from the table, to be freed once no
+ *  reader is in an epoch that could still see it, and advances the epoch.
+ *  Must hold the table's lock.
+ */
+static void _retire(RcuHashTable_t *table, void *ptr,
+                    void (*free_ptr)(void *))
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    size_t epoch = atomic_load_explicit(&table->epoch, memory_order_relaxed);
+    RcuHTRetired_t *retired = malloc(sizeof(RcuHTRetired_t));
+    if (retired == NULL) {
+        // nowhere to keep it, so wait out the readers that could see it
+        atomic_store_explicit(&table->epoch, epoch + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        for (size_t i = 0; i < table->reader_count; i++) {
+            size_t reader_epoch;
+            do {
+                reader_epoch = atomic_load_explicit(
+                    &table->readers[i].epoch, memory_order_acquire);
+            } while (reader_epoch != 0 && reader_epoch <= epoch);
+        }
+        free_ptr(ptr);
+        return;
+    }
+    *retired = (RcuHTRetired_t){.ptr = ptr,
+                                .free_ptr = free_ptr,
+                                .epoch = epoch,
+                                .next = table->retired};
+    table->retired = retired;
+    atomic_store_explicit(&table->epoch, epoch + 1, memory_order_relaxed);
+}
+
+/**
+ * @brief
+ *  Frees the retired pointers that no reader can still see. Must hold the
+ *  table's lock.
+ */
+static void _reclaim(RcuHashTable_t *table)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    size_t min_epoch = SIZE_MAX;
+    for (size_t i = 0; i < table->reader_count; i++) {
+        size_t epoch = atomic_load_explicit(&table->readers[i].epoch,
+                                            memory_order_acquire);
+        if (epoch != 0 && epoch < min_epoch) {
+            min_epoch = epoch;
+        }
+    }
+    RcuHTRetired_t **p_retired = &table->retired;
+    while (*p_retired != NULL) {
+        RcuHTRetired_t *retired = *p_retired;
+        if (retired->epoch < min_epoch) {
+            *p_retired = retired->next;
+            retired->free_ptr(retired->ptr);
+            free(retired);
+        } else {
+            p_retired = &retired->next;
+        }
+    }
+}
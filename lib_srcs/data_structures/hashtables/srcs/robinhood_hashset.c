@@ -0,0 +1,317 @@
+/**
+ * @file robinhood_hashset.c
+ *
+ * @brief
+ *  Structs and functions for robinhood open address hashsets.
+ *
+ * @implements
+ *  robinhood_hashset.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "robinhood_hashset.h"
+#include "_robinhood_slots.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct RobinHSTakeIf { // what _removeIf removes with
+    const RobinHashSet_t *other;
+    bool is_in_other;
+    void (*free_key)(void *);
+} RobinHSTakeIf_t;
+
+defRobinSlots(robinHSKeys, void *)
+
+static bool _findIdx(const RobinHashSet_t *set, const void *key, size_t *idx);
+static void _setMaxCount(RobinHashSet_t *set, size_t max_count);
+static bool _reserve(RobinHashSet_t *set, size_t entry_count);
+static int _resize(RobinHashSet_t *set, size_t new_count);
+static size_t _removeIf(RobinHashSet_t *set, const RobinHashSet_t *other,
+                        bool is_in_other, void (*free_key)(void *));
+static bool _takeIf(void **key, void *arg);
+
+RobinHashSet_t *
+RobinHashSetCreate(size_t bucket_count, float max_load_prop,
+                   HTIndexing_t indexing, size_t (*hash_func)(const void *),
+                   int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    RobinHashSet_t *new_set = calloc(1, sizeof(RobinHashSet_t));
+    if (new_set == NULL) {
+        return NULL;
+    }
+    bucket_count = HTIndexingRound(indexing, bucket_count);
+    new_set->max_load = max_load_prop;
+    new_set->max_psl = ROBIN_HT_MAX_PSL;
+    _setMaxCount(new_set, bucket_count);
+    new_set->indexing = indexing;
+    new_set->hash = hash_func;
+    new_set->comp_key = comp_key;
+    new_set->keys = malloc(bucket_count * sizeof(void *));
+    new_set->psls = calloc(bucket_count, sizeof(unsigned char));
+    if (new_set->keys == NULL || new_set->psls == NULL) {
+        free(new_set->keys);
+        free(new_set->psls);
+        free(new_set);
+        return NULL;
+    }
+    return new_set;
+}
+
+void RobinHashSetClear(RobinHashSet_t **p_set, void (*free_key)(void *))
+{
+    assert(p_set != NULL);
+    assert(*p_set != NULL);
+
+    RobinHashSet_t *set = *p_set;
+    if (free_key != NULL) {
+        for (size_t i = 0; i < set->count.max; i++) {
+            if (set->psls[i] != 0) {
+                free_key(set->keys[i]);
+            }
+        }
+    }
+    free(set->keys);
+    free(set->psls);
+    free(set);
+    *p_set = NULL;
+}
+
+int RobinHashSetAdd(RobinHashSet_t *set, void *key)
+{
+    assert(set != NULL);
+
+    size_t i;
+    if (_findIdx(set, key, &i)) {
+        return 0;
+    }
+    if (set->count.used >= set->count.limit) {
+        size_t new_count = robinSlotsGrownCount(set->count.max, sizeof(void *));
+        if (set->max_load == 0 || new_count == 0
+            || _resize(set, new_count) != 1) {
+            return -1;
+        }
+    }
+    i = HTIndexingReduce(set->indexing, set->hash(key), set->count.max);
+    if (!robinSlotsCanAdd(set->psls, i, set->count.max, set->indexing,
+                          set->max_psl)) {
+        // growing only helps if the keys aren't colliding on their own
+        size_t new_count = robinSlotsGrownCount(set->count.max, sizeof(void *));
+        if (robinSlotsIsWorthGrowing(set->count.used, set->count.max)
+            && new_count != 0 && _resize(set, new_count) == 1) {
+            i = HTIndexingReduce(set->indexing, set->hash(key),
+                                 set->count.max);
+        }
+        if (!robinSlotsCanAdd(set->psls, i, set->count.max, set->indexing,
+                              ROBIN_HT_MAX_PSL)) {
+            return -1;
+        }
+    }
+    robinHSKeysAdd(set->keys, set->psls, key, i, set->count.max,
+                   set->indexing);
+    set->count.used += 1;
+    return 1;
+}
+
+bool RobinHashSetRemove(RobinHashSet_t *set, const void *key,
+                        void (*free_key)(void *))
+{
+    assert(set != NULL);
+
+    size_t i;
+    if (!_findIdx(set, key, &i)) {
+        return false;
+    }
+    if (free_key != NULL) {
+        free_key(set->keys[i]);
+    }
+    robinHSKeysRemove(set->keys, set->psls, i, set->count.max, set->indexing);
+    set->count.used -= 1;
+    return true;
+}
+
+bool RobinHashSetContains(const RobinHashSet_t *set, const void *key)
+{
+    assert(set != NULL);
+
+    size_t i;
+    return _findIdx(set, key, &i);
+}
+
+bool RobinHashSetUnion(RobinHashSet_t *set, const RobinHashSet_t *other)
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    if (set == other) {
+        return true;
+    }
+    if (!_reserve(set, set->count.used + other->count.used)) {
+        return false;
+    }
+    for (size_t i = 0; i < other->count.max; i++) {
+        if (other->psls[i] != 0 && RobinHashSetAdd(set, other->keys[i]) == -1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t RobinHashSetIntersect(RobinHashSet_t *set, const RobinHashSet_t *other,
+                             void (*free_key)(void *))
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    if (set == other) {
+        return 0;
+    }
+    return _removeIf(set, other, false, free_key);
+}
+
+size_t RobinHashSetDifference(RobinHashSet_t *set, const RobinHashSet_t *other,
+                              void (*free_key)(void *))
+{
+    assert(set != NULL);
+    assert(other != NULL);
+
+    if (set == other) {
+        // every key is in the other set, without it changing under the sweep
+        size_t removed = set->count.used;
+        for (size_t i = 0; i < set->count.max; i++) {
+            if (set->psls[i] != 0 && free_key != NULL) {
+                free_key(set->keys[i]);
+            }
+        }
+        memset(set->psls, 0, set->count.max);
+        set->count.used = 0;
+        return removed;
+    }
+    return _removeIf(set, other, true, free_key);
+}
+
+/**
+ * @brief
+ *  Finds the bucket holding a key.
+ */
+static bool _findIdx(const RobinHashSet_t *set, const void *key, size_t *idx)
+{
+    size_t i = HTIndexingReduce(set->indexing, set->hash(key), set->count.max);
+    for (unsigned int psl = 1; psl <= set->psls[i]; psl++) {
+        if (set->comp_key(set->keys[i], key) == 0) {
+            *idx = i;
+            return true;
+        }
+        i = HTIndexingNext(set->indexing, i, set->count.max);
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *  Sets the number of buckets and the count of used buckets at which adds
+ *  rehash, as in the robinhood hashtable.
+ */
+static void _setMaxCount(RobinHashSet_t *set, size_t max_count)
+{
+    set->count.max = max_count;
+    set->count.limit = robinSlotsLimit(set->max_load, max_count);
+}
+
+/**
+ * @brief
+ *  Grows the set, if needed, so entry_count keys can be added without
+ *  rehashing again.
+ */
+static bool _reserve(RobinHashSet_t *set, size_t entry_count)
+{
+    if (set->max_load == 0) {
+        return true;
+    }
+    // adds rehash once used reaches the limit, so stay just below it
+    double new_count_f = entry_count / set->max_load + 1;
+    if (new_count_f > (double)(SIZE_MAX / 2 / sizeof(void *))) {
+        return false;
+    }
+    size_t new_count = HTIndexingRound(set->indexing, (size_t)new_count_f);
+    return new_count <= set->count.max || _resize(set, new_count) == 1;
+}
+
+/**
+ * @brief
+ *  Rehashes every key into new_count buckets.
+ *
+ * @return
+ *  1 : rehashed successfully @n
+ *  0 : memory allocation falied, or a probe sequence would grow past
+ *      ROBIN_HT_MAX_PSL @n
+ */
+static int _resize(RobinHashSet_t *set, size_t new_count)
+{
+    new_count = HTIndexingRound(set->indexing, new_count);
+    void **new_keys = malloc(new_count * sizeof(void *));
+    unsigned char *new_psls = calloc(new_count, sizeof(unsigned char));
+    if (new_keys == NULL || new_psls == NULL) {
+        free(new_keys);
+        free(new_psls);
+        return 0;
+    }
+    for (size_t i = 0; i < set->count.max; i++) {
+        if (set->psls[i] == 0) {
+            continue;
+        }
+        size_t new_i = HTIndexingReduce(set->indexing,
+                                        set->hash(set->keys[i]), new_count);
+        if (!robinHSKeysAdd(new_keys, new_psls, set->keys[i], new_i,
+                            new_count, set->indexing)) {
+            free(new_keys);
+            free(new_psls);
+            return 0;
+        }
+    }
+    free(set->keys);
+    free(set->psls);
+    set->keys = new_keys;
+    set->psls = new_psls;
+    _setMaxCount(set, new_count);
+    return 1;
+}
+
+/**
+ * @brief
+ *  Removes the keys whose membership of other is is_in_other in one sweep,
+ *  as RobinHashTableRemoveIf does.
+ */
+static size_t _removeIf(RobinHashSet_t *set, const RobinHashSet_t *other,
+                        bool is_in_other, void (*free_key)(void *))
+{
+    RobinHSTakeIf_t take_if
+        = {.other = other, .is_in_other = is_in_other, .free_key = free_key};
+    size_t removed = robinHSKeysRemoveIf(set->keys, set->psls, set->count.max,
+                                         set->indexing, _takeIf, &take_if);
+    set->count.used -= removed;
+    return removed;
+}
+
+/**
+ * @brief
+ *  Removes a key for _removeIf if its membership of the other set matches,
+ *  freeing it if given a function to do so.
+ */
+static bool _takeIf(void **key, void *arg)
+{
+    RobinHSTakeIf_t *take_if = arg;
+    if (RobinHashSetContains(take_if->other, *key) != take_if->is_in_other) {
+        return false;
+    }
+    if (take_if->free_key != NULL) {
+        take_if->free_key(*key);
+    }
+    return true;
+}
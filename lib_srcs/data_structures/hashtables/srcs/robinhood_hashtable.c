@@ -12,35 +12,72 @@
  * @date 2023-05-22
  */
 #include "robinhood_hashtable.h"
-#include "swap_funcs.h"
+#include "_robinhood_slots.h"
+#include "hashtable_index.h"
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-static void _addBucket(struct RobinHTBucket **buckets,
-                       RobinHTBucket_t *new_bucket, size_t i,
-                       size_t max_count);
+static RobinHashTable_t *_create(size_t bucket_count, float max_load_prop,
+                                 HTIndexing_t indexing,
+                                 int (*comp_key)(const void *, const void *));
+typedef struct RobinHTTakeIf { // what RobinHashTableRemoveIf removes with
+    bool (*pred)(const void *, const void *, void *);
+    void *arg;
+    void (*free_data)(void *);
+    void (*free_key)(void *);
+} RobinHTTakeIf_t;
+
+defRobinSlots(robinHTBuckets, RobinHTBucket_t)
+
+static size_t _hashKey(const RobinHashTable_t *table, const void *key);
+static void _setMaxCount(RobinHashTable_t *table, size_t max_count);
+static size_t _grownCount(const RobinHashTable_t *table);
+static bool _isWorthGrowing(const RobinHashTable_t *table);
+static int _resize(RobinHashTable_t *table, size_t new_count);
+static int _startMigration(RobinHashTable_t *table, size_t new_count);
+static bool _migrate(RobinHashTable_t *table, size_t step);
+static bool _findBucket(RobinHashTable_t *table, size_t hash, const void *key,
+                        size_t *idx);
+static bool _findOldBucket(RobinHashTable_t *table, size_t hash,
+                           const void *key, size_t *idx);
+static bool _takeIf(RobinHTBucket_t *bucket, void *arg);
+static void _addPslStats(const unsigned char *psls, size_t max_count,
+                         HTStats_t *stats, size_t *probe_sum);
+static void _scanHome(RobinHashTable_t *table, bool is_old, size_t home,
+                      void (*func)(void *, void *, void *), void *arg);
 
 RobinHashTable_t *
 RobinHashTableCreate(size_t bucket_count, float max_load_prop,
-                     size_t (*hash_func)(const void *),
+                     HTIndexing_t indexing, size_t (*hash_func)(const void *),
                      int (*comp_key)(const void *, const void *))
 {
     assert(hash_func != NULL);
     assert(comp_key != NULL);
 
-    RobinHashTable_t *new_table = calloc(1, sizeof(RobinHashTable_t));
-    if (new_table == NULL) {
-        return NULL;
+    RobinHashTable_t *new_table
+        = _create(bucket_count, max_load_prop, indexing, comp_key);
+    if (new_table != NULL) {
+        new_table->hash = hash_func;
     }
-    new_table->count.max = bucket_count;
-    new_table->max_load = max_load_prop;
-    new_table->hash = hash_func;
-    new_table->comp_key = comp_key;
-    new_table->buckets = calloc(bucket_count, sizeof(RobinHTBucket_t *));
-    if (new_table->buckets == NULL) {
-        free(new_table);
-        return NULL;
+    return new_table;
+}
+
+RobinHashTable_t *
+RobinHashTableCreateSeeded(size_t bucket_count, float max_load_prop,
+                           HTIndexing_t indexing,
+                           size_t (*hash_func)(const void *, size_t),
+                           int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    RobinHashTable_t *new_table
+        = _create(bucket_count, max_load_prop, indexing, comp_key);
+    if (new_table != NULL) {
+        new_table->seeded_hash = hash_func;
+        new_table->seed = randomSeed();
     }
     return new_table;
 }
@@ -51,17 +88,38 @@ void RobinHashTableClear(RobinHashTable_t **p_table,
     assert(p_table != NULL);
     assert(*p_table != NULL);
 
-    for (size_t i = 0; i < (*p_table)->count.max; i++) {
+    RobinHashTable_t *table = *p_table;
+    for (size_t i = 0; i < table->count.max; i++) {
+        if (table->psls[i] == 0) {
+            continue;
+        }
         if (free_data != NULL) {
-            free_data((*p_table)->buckets[i]->data);
+            free_data(table->buckets[i].data);
         }
         if (free_key != NULL) {
-            free_key((*p_table)->buckets[i]->key);
+            free_key(table->buckets[i].key);
         }
-        free((*p_table)->buckets[i]);
     }
-    free((*p_table)->buckets);
-    free(*p_table);
+    if (table->old.buckets != NULL) {
+        // buckets before the cursor were already moved to the new buckets
+        size_t i = table->old.cursor;
+        for (size_t done = table->old.done; done < table->old.max; done++) {
+            if (table->old.psls[i] != 0) {
+                if (free_data != NULL) {
+                    free_data(table->old.buckets[i].data);
+                }
+                if (free_key != NULL) {
+                    free_key(table->old.buckets[i].key);
+                }
+            }
+            i = HTIndexingNext(table->indexing, i, table->old.max);
+        }
+        free(table->old.buckets);
+        free(table->old.psls);
+    }
+    free(table->buckets);
+    free(table->psls);
+    free(table);
     *p_table = NULL;
 }
 
@@ -69,123 +127,672 @@ bool RobinHashTableAdd(RobinHashTable_t *table, void *key, void *data)
 {
     assert(table != NULL);
 
-    if (table->max_load == 0) {
-        if (table->count.used >= table->count.max) {
+    if (table->old.buckets != NULL) {
+        _migrate(table, table->rehash_step);
+    }
+    size_t used = table->count.used - table->old.used;
+    if (used >= table->count.limit) {
+        if (table->max_load == 0) {
+            return false;
+        }
+        if (table->old.buckets != NULL && !_migrate(table, SIZE_MAX)) {
             return false;
         }
-    } else if ((float)table->count.used / table->count.max >= table->max_load
-               || table->count.used >= table->count.max) {
-        if (RobinHashTableRehash(table, 2 * table->count.max) == 0) {
+        size_t new_count = _grownCount(table);
+        if (new_count == 0) {
+            return false;
+        }
+        if (table->rehash_step == 0) {
+            if (RobinHashTableRehash(table, new_count) == 0) {
+                return false;
+            }
+        } else if (_startMigration(table, new_count) == 0) {
             return false;
         }
     }
-    RobinHTBucket_t *new_bucket = calloc(1, sizeof(RobinHTBucket_t));
-    if (new_bucket == NULL) {
-        return false;
+    RobinHTBucket_t new_bucket
+        = {.key = key, .data = data, .hash = _hashKey(table, key)};
+    size_t i = HTIndexingReduce(table->indexing, new_bucket.hash,
+                                table->count.max);
+    if (!robinSlotsCanAdd(table->psls, i, table->count.max, table->indexing,
+                          table->max_psl)
+        && table->old.buckets != NULL) {
+        // keys colliding with this one may still be waiting in the old
+        // buckets, so only judge the fit once they've all moved over
+        if (!_migrate(table, SIZE_MAX)) {
+            return false;
+        }
+        i = HTIndexingReduce(table->indexing, new_bucket.hash,
+                             table->count.max);
+    }
+    if (!robinSlotsCanAdd(table->psls, i, table->count.max, table->indexing,
+                          table->max_psl)) {
+        // growing only helps if the keys aren't colliding on their own
+        if (_isWorthGrowing(table) && _grownCount(table) != 0
+            && RobinHashTableRehash(table, _grownCount(table)) == 1) {
+            i = HTIndexingReduce(table->indexing, new_bucket.hash,
+                                 table->count.max);
+        }
+        if (!robinSlotsCanAdd(table->psls, i, table->count.max,
+                              table->indexing, ROBIN_HT_MAX_PSL)) {
+            return false;
+        }
     }
-    new_bucket->data = data;
-    new_bucket->key = key;
-    size_t i = table->hash(key) % table->count.max;
-    _addBucket(table->buckets, new_bucket, i, table->count.max);
+    robinHTBucketsAdd(table->buckets, table->psls, new_bucket, i,
+                      table->count.max, table->indexing);
     table->count.used += 1;
     return true;
 }
 
 void *RobinHashTableRemove(RobinHashTable_t *table, void *key,
-                           void (*free_data)(void *), void (*free_key)(void *))
+                           void (*free_key)(void *))
 {
     assert(table != NULL);
 
+    if (table->old.buckets != NULL) {
+        _migrate(table, table->rehash_step);
+    }
+    HT_COUNT(table, lookups, 1);
     void *data = NULL;
-    int found = 0;
-    size_t curr_psl = 0;
-    size_t i = table->hash(key) % table->count.max;
-    while (table->buckets[i] != NULL && curr_psl <= table->buckets[i]->psl) {
-        if (table->comp_key(table->buckets[i]->key, key) == 0) {
-            data = table->buckets[i]->data;
-            if (free_key != NULL) {
-                free_key(table->buckets[i]->key);
-            }
-            free(table->buckets[i]);
-            found = 1;
-            break;
+    size_t hash = _hashKey(table, key);
+    size_t i;
+    if (_findBucket(table, hash, key, &i)) {
+        data = table->buckets[i].data;
+        if (free_key != NULL) {
+            free_key(table->buckets[i].key);
         }
-        i = (i + 1) % table->count.max;
-        curr_psl++;
-    }
-    if (found) {
-        size_t prev_i = i;
-        i = (i + 1) % table->count.max;
-        while (table->buckets[i] != NULL && table->buckets[i]->psl > 0) {
-            memcpy(&table->buckets[prev_i], &table->buckets[i],
-                   sizeof(RobinHTBucket_t *));
-            prev_i = i;
-            i = (i + 1) % table->count.max;
+        robinHTBucketsRemove(table->buckets, table->psls, i, table->count.max,
+                             table->indexing);
+        table->count.used -= 1;
+    } else if (table->old.buckets != NULL
+               && _findOldBucket(table, hash, key, &i)) {
+        data = table->old.buckets[i].data;
+        if (free_key != NULL) {
+            free_key(table->old.buckets[i].key);
         }
-        table->buckets[prev_i] = NULL;
+        robinHTBucketsRemove(table->old.buckets, table->old.psls, i,
+                             table->old.max, table->indexing);
+        table->old.used -= 1;
+        table->count.used -= 1;
     }
     return data;
 }
 
+size_t RobinHashTableRemoveIf(RobinHashTable_t *table,
+                              bool (*pred)(const void *, const void *, void *),
+                              void *arg, void (*free_data)(void *),
+                              void (*free_key)(void *))
+{
+    assert(table != NULL);
+    assert(pred != NULL);
+
+    if (table->old.buckets != NULL && !_migrate(table, SIZE_MAX)) {
+        return 0;
+    }
+    RobinHTTakeIf_t take_if = {.pred = pred,
+                               .arg = arg,
+                               .free_data = free_data,
+                               .free_key = free_key};
+    size_t removed = robinHTBucketsRemoveIf(table->buckets, table->psls,
+                                            table->count.max, table->indexing,
+                                            _takeIf, &take_if);
+    table->count.used -= removed;
+    return removed;
+}
+
 void *RobinHashTableFind(RobinHashTable_t *table, void *key)
 {
     assert(table != NULL);
 
-    void *data = NULL;
-    size_t curr_psl = 0;
-    size_t i = table->hash(key) % table->count.max;
-    while (table->buckets[i] != NULL && curr_psl <= table->buckets[i]->psl) {
-        if (table->comp_key(table->buckets[i]->key, key) == 0) {
-            data = table->buckets[i]->data;
-            break;
-        }
-        i = (i + 1) % table->count.max;
-        curr_psl++;
+    if (table->old.buckets != NULL) {
+        _migrate(table, table->rehash_step);
+    }
+    HT_COUNT(table, lookups, 1);
+    size_t hash = _hashKey(table, key);
+    size_t i;
+    if (_findBucket(table, hash, key, &i)) {
+        return table->buckets[i].data;
+    }
+    if (table->old.buckets != NULL && _findOldBucket(table, hash, key, &i)) {
+        return table->old.buckets[i].data;
+    }
+    return NULL;
+}
+
+void RobinHashTableFindBatch(RobinHashTable_t *table, void **keys,
+                             size_t key_count, void **results)
+{
+    assert(table != NULL);
+
+    if (table->old.buckets != NULL) {
+        _migrate(table, table->rehash_step);
+    }
+    HT_COUNT(table, lookups, key_count);
+    size_t hashes[HT_FIND_BATCH];
+    for (size_t start = 0; start < key_count; start += HT_FIND_BATCH) {
+        size_t batch = key_count - start;
+        if (batch > HT_FIND_BATCH) {
+            batch = HT_FIND_BATCH;
+        }
+        for (size_t k = 0; k < batch; k++) {
+            hashes[k] = _hashKey(table, keys[start + k]);
+            size_t i = HTIndexingReduce(table->indexing, hashes[k],
+                                        table->count.max);
+            HT_PREFETCH(&table->psls[i]);
+            HT_PREFETCH(&table->buckets[i]);
+        }
+        for (size_t k = 0; k < batch; k++) {
+            void *key = keys[start + k];
+            size_t i;
+            results[start + k] = NULL;
+            if (_findBucket(table, hashes[k], key, &i)) {
+                results[start + k] = table->buckets[i].data;
+            } else if (table->old.buckets != NULL
+                       && _findOldBucket(table, hashes[k], key, &i)) {
+                results[start + k] = table->old.buckets[i].data;
+            }
+        }
     }
-    return data;
 }
 
 int RobinHashTableRehash(RobinHashTable_t *table, size_t new_count)
 {
     assert(table != NULL);
 
-    float max_load = table->max_load;
-    if (max_load == 0) {
-        max_load = 1;
+    if (table->old.buckets != NULL && !_migrate(table, SIZE_MAX)) {
+        return 0;
+    }
+    if (new_count > SIZE_MAX / 2 / sizeof(RobinHTBucket_t)) {
+        return 0; // rounding up to a power of 2 could overflow
     }
-    if ((float)new_count <= max_load * table->count.max) {
+    new_count = HTIndexingRound(table->indexing, new_count);
+    if (new_count <= table->count.limit) {
         return -1;
     }
-    RobinHTBucket_t **new_buckets
-        = calloc(new_count, sizeof(RobinHTBucket_t *));
-    if (new_buckets == NULL) {
+    return _resize(table, new_count);
+}
+
+bool RobinHashTableReserve(RobinHashTable_t *table, size_t entry_count)
+{
+    assert(table != NULL);
+
+    if (table->old.buckets != NULL && !_migrate(table, SIZE_MAX)) {
+        return false;
+    }
+    // adds rehash once used / max reaches max_load, so stay just below it
+    double new_count_f = entry_count;
+    if (table->max_load != 0) {
+        new_count_f = entry_count / table->max_load + 1;
+    }
+    if (new_count_f > (double)(SIZE_MAX / 2 / sizeof(RobinHTBucket_t))) {
+        return false;
+    }
+    size_t new_count = (size_t)new_count_f;
+    new_count = HTIndexingRound(table->indexing, new_count);
+    if (new_count <= table->count.max) {
+        return true;
+    }
+    return _resize(table, new_count) == 1;
+}
+
+void RobinHashTableIterBegin(const RobinHashTable_t *table,
+                             RobinHTIter_t *iter)
+{
+    assert(table != NULL);
+    assert(iter != NULL);
+
+    memset(iter, 0, sizeof(RobinHTIter_t));
+}
+
+bool RobinHashTableIterNext(const RobinHashTable_t *table, RobinHTIter_t *iter)
+{
+    assert(table != NULL);
+    assert(iter != NULL);
+
+    while (true) {
+        const RobinHTBucket_t *buckets = table->buckets;
+        const unsigned char *psls = table->psls;
+        size_t max_count = table->count.max;
+        if (iter->is_old) {
+            buckets = table->old.buckets;
+            psls = table->old.psls;
+            max_count = table->old.max;
+        }
+        for (; iter->i < max_count; iter->i++) {
+            if (psls[iter->i] != 0) {
+                iter->key = buckets[iter->i].key;
+                iter->data = buckets[iter->i].data;
+                iter->i += 1;
+                return true;
+            }
+        }
+        if (iter->is_old || table->old.buckets == NULL) {
+            return false;
+        }
+        iter->is_old = true;
+        iter->i = 0;
+    }
+}
+
+size_t RobinHashTableScan(RobinHashTable_t *table, size_t cursor, size_t step,
+                          void (*func)(void *, void *, void *), void *arg)
+{
+    assert(table != NULL);
+    assert(func != NULL);
+
+    size_t counts[2] = {table->count.max, table->old.max};
+    bool has_old = table->old.buckets != NULL;
+    // both bucket arrays are scanned while a migration is in progress
+    size_t small = (has_old && counts[1] < counts[0]) ? 1 : 0;
+    size_t large = has_old ? 1 - small : 0;
+    do {
+        if (table->indexing != HT_INDEX_MASK) {
+            for (size_t t = 0; t <= (size_t)has_old; t++) {
+                if (cursor < counts[t]) {
+                    _scanHome(table, t, cursor, func, arg);
+                }
+            }
+            cursor += 1;
+            if (cursor >= counts[large]) {
+                cursor = 0;
+            }
+            continue;
+        }
+        size_t small_mask = counts[small] - 1;
+        size_t large_mask = counts[large] - 1;
+        _scanHome(table, small, cursor & small_mask, func, arg);
+        if (large != small) {
+            // every bucket of the larger array split from the smaller's one
+            do {
+                _scanHome(table, large, cursor & large_mask, func, arg);
+                cursor = (((cursor | small_mask) + 1) & ~small_mask)
+                         | (cursor & small_mask);
+            } while (cursor & (small_mask ^ large_mask));
+        }
+        cursor = HTScanNext(cursor, small_mask);
+    } while (step-- > 1 && cursor != 0);
+    return cursor;
+}
+
+void RobinHashTableStats(const RobinHashTable_t *table, HTStats_t *stats)
+{
+    assert(table != NULL);
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(HTStats_t));
+    stats->entries = table->count.used;
+    stats->buckets = table->count.max + table->old.max;
+    stats->load = (double)stats->entries / stats->buckets;
+    size_t probe_sum = 0;
+    _addPslStats(table->psls, table->count.max, stats, &probe_sum);
+    if (table->old.buckets != NULL) {
+        _addPslStats(table->old.psls, table->old.max, stats, &probe_sum);
+    }
+    if (stats->entries != 0) {
+        stats->mean_probe = (double)probe_sum / stats->entries;
+    }
+    stats->rehashes = table->rehashes;
+#ifdef HT_STATS
+    stats->counters = table->counters;
+#endif
+}
+
+/**
+ * @brief
+ *  Allocates a table with everything but its hash function set.
+ */
+static RobinHashTable_t *_create(size_t bucket_count, float max_load_prop,
+                                 HTIndexing_t indexing,
+                                 int (*comp_key)(const void *, const void *))
+{
+    RobinHashTable_t *new_table = calloc(1, sizeof(RobinHashTable_t));
+    if (new_table == NULL) {
+        return NULL;
+    }
+    bucket_count = HTIndexingRound(indexing, bucket_count);
+    new_table->max_load = max_load_prop;
+    new_table->max_psl = ROBIN_HT_MAX_PSL;
+    _setMaxCount(new_table, bucket_count);
+    new_table->indexing = indexing;
+    new_table->comp_key = comp_key;
+    new_table->buckets = malloc(bucket_count * sizeof(RobinHTBucket_t));
+    new_table->psls = calloc(bucket_count, sizeof(unsigned char));
+    if (new_table->buckets == NULL || new_table->psls == NULL) {
+        free(new_table->buckets);
+        free(new_table->psls);
+        free(new_table);
+        return NULL;
+    }
+    return new_table;
+}
+
+/**
+ * @brief
+ *  Hashes a key with the table's seeded hash if it has one.
+ */
+static size_t _hashKey(const RobinHashTable_t *table, const void *key)
+{
+    if (table->seeded_hash != NULL) {
+        return table->seeded_hash(key, table->seed);
+    }
+    return table->hash(key);
+}
+
+/**
+ * @brief
+ *  Moves all entries in the current buckets into new_count new buckets. Any
+ *  old buckets still being migrated are left untouched.
+ *
+ * @return
+ *  1 : resized successfully @n
+ *  0 : unable to allocate memory, or a probe sequence would exceed
+ *      ROBIN_HT_MAX_PSL in the new buckets @n
+ */
+static int _resize(RobinHashTable_t *table, size_t new_count)
+{
+    double start = HTStatsNow();
+    RobinHTBucket_t *new_buckets = malloc(new_count * sizeof(RobinHTBucket_t));
+    unsigned char *new_psls = calloc(new_count, sizeof(unsigned char));
+    if (new_buckets == NULL || new_psls == NULL) {
+        free(new_buckets);
+        free(new_psls);
         return 0;
     }
+    size_t used = table->count.used - table->old.used;
     size_t rehash_count = 0;
-    for (size_t i = 0;
-         i < table->count.max && rehash_count <= table->count.used; i++) {
-        if (table->buckets[i] != NULL) {
-            size_t new_i = table->hash(table->buckets[i]->key) % new_count;
-            _addBucket(new_buckets, table->buckets[i], new_i, new_count);
-            rehash_count++;
+    for (size_t i = 0; i < table->count.max && rehash_count < used; i++) {
+        if (table->psls[i] == 0) {
+            continue;
+        }
+        RobinHTBucket_t bucket = table->buckets[i];
+        size_t new_i
+            = HTIndexingReduce(table->indexing, bucket.hash, new_count);
+        if (!robinHTBucketsAdd(new_buckets, new_psls, bucket, new_i,
+                               new_count, table->indexing)) {
+            free(new_buckets);
+            free(new_psls);
+            return 0;
         }
+        rehash_count++;
     }
     free(table->buckets);
+    free(table->psls);
+    table->buckets = new_buckets;
+    table->psls = new_psls;
+    _setMaxCount(table, new_count);
+    table->rehashes.count += 1;
+    table->rehashes.secs += HTStatsNow() - start;
+    return 1;
+}
+
+/**
+ * @brief
+ *  Swaps in new_count empty buckets and keeps the current ones as the old
+ *  buckets, to be migrated a few at a time by _migrate. Falls back to a full
+ *  resize if the current buckets have no empty bucket to start from.
+ *
+ * @return
+ *  1 : started (or resized) successfully @n
+ *  0 : unable to allocate memory @n
+ */
+static int _startMigration(RobinHashTable_t *table, size_t new_count)
+{
+    new_count = HTIndexingRound(table->indexing, new_count);
+    size_t start = 0;
+    while (start < table->count.max && table->psls[start] != 0) {
+        start++;
+    }
+    if (start == table->count.max) {
+        return _resize(table, new_count);
+    }
+    RobinHTBucket_t *new_buckets = malloc(new_count * sizeof(RobinHTBucket_t));
+    unsigned char *new_psls = calloc(new_count, sizeof(unsigned char));
+    if (new_buckets == NULL || new_psls == NULL) {
+        free(new_buckets);
+        free(new_psls);
+        return 0;
+    }
+    table->old.buckets = table->buckets;
+    table->old.psls = table->psls;
+    table->old.max = table->count.max;
+    table->old.used = table->count.used;
+    // clusters never wrap past an empty bucket, so migrating from just after
+    // one keeps every unmigrated probe sequence intact
+    table->old.first = HTIndexingNext(table->indexing, start, table->old.max);
+    table->old.cursor = table->old.first;
+    table->old.done = 0;
     table->buckets = new_buckets;
-    table->count.max = new_count;
+    table->psls = new_psls;
+    _setMaxCount(table, new_count);
+    table->rehashes.count += 1;
     return 1;
 }
 
-static void _addBucket(RobinHTBucket_t **buckets,
-                       RobinHTBucket_t *new_bucket, size_t i,
-                       size_t max_count)
+/**
+ * @brief
+ *  Moves up to step old buckets, in order from the cursor, into the current
+ *  buckets, and frees the old buckets once they are empty.
+ *
+ * @return
+ *  true  : migrated successfully @n
+ *  false : an entry doesn't fit in the current buckets and they can't grow
+ *          (or growing wouldn't help), the entry is left in the old buckets
+ *          and the migration where it stopped @n
+ */
+static bool _migrate(RobinHashTable_t *table, size_t step)
+{
+    // any resize below is timed as part of the migration, not on its own
+    double start = HTStatsNow();
+    double secs = table->rehashes.secs;
+    for (; step > 0 && table->old.used > 0; step--) {
+        size_t j = table->old.cursor;
+        if (table->old.psls[j] != 0) {
+            RobinHTBucket_t bucket = table->old.buckets[j];
+            size_t i = HTIndexingReduce(table->indexing, bucket.hash,
+                                        table->count.max);
+            if (!robinSlotsCanAdd(table->psls, i, table->count.max,
+                                  table->indexing, ROBIN_HT_MAX_PSL)) {
+                // growing only helps if the keys aren't colliding on their own
+                if (_isWorthGrowing(table) && _grownCount(table) != 0
+                    && _resize(table, _grownCount(table)) == 1) {
+                    i = HTIndexingReduce(table->indexing, bucket.hash,
+                                         table->count.max);
+                }
+                if (!robinSlotsCanAdd(table->psls, i, table->count.max,
+                                      table->indexing, ROBIN_HT_MAX_PSL)) {
+                    table->rehashes.secs = secs + HTStatsNow() - start;
+                    return false;
+                }
+            }
+            if (!robinHTBucketsAdd(table->buckets, table->psls, bucket, i,
+                                   table->count.max, table->indexing)) {
+                table->rehashes.secs = secs + HTStatsNow() - start;
+                return false;
+            }
+            table->old.psls[j] = 0;
+            table->old.used -= 1;
+        }
+        table->old.cursor = HTIndexingNext(table->indexing, j, table->old.max);
+        table->old.done += 1;
+    }
+    if (table->old.used == 0) {
+        free(table->old.buckets);
+        free(table->old.psls);
+        memset(&table->old, 0, sizeof(table->old));
+    }
+    table->rehashes.secs = secs + HTStatsNow() - start;
+    return true;
+}
+
+/**
+ * @brief
+ *  Finds the bucket holding a key in the current buckets.
+ *
+ * @return
+ *  true  : key found, its bucket is stored in idx @n
+ *  false : key not found @n
+ */
+static bool _findBucket(RobinHashTable_t *table, size_t hash, const void *key,
+                        size_t *idx)
+{
+    RobinHTBucket_t *buckets = table->buckets;
+    unsigned char *psls = table->psls;
+    size_t curr_psl = 1;
+    size_t i = HTIndexingReduce(table->indexing, hash, table->count.max);
+    while (curr_psl <= psls[i]) {
+        HT_COUNT(table, probes, 1);
+        if (buckets[i].hash == hash) {
+            HT_COUNT(table, compares, 1);
+            if (table->comp_key(buckets[i].key, key) == 0) {
+                *idx = i;
+                return true;
+            }
+        }
+        i = HTIndexingNext(table->indexing, i, table->count.max);
+        curr_psl++;
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *  Finds the bucket holding a key in the old buckets still being migrated.
+ *  A key whose home bucket was already migrated can only be past the cursor,
+ *  so the probe starts there instead.
+ *
+ * @return
+ *  true  : key found, its bucket is stored in idx @n
+ *  false : key not found @n
+ */
+static bool _findOldBucket(RobinHashTable_t *table, size_t hash,
+                           const void *key, size_t *idx)
 {
-    RobinHTBucket_t *curr_bucket = new_bucket;
-    for (; buckets[i] != NULL; i = (i + 1) % max_count) {
-        if (curr_bucket->psl > buckets[i]->psl) {
-            swap(&curr_bucket, &buckets[i], sizeof(RobinHTBucket_t *));
+    RobinHTBucket_t *buckets = table->old.buckets;
+    unsigned char *psls = table->old.psls;
+    size_t i = HTIndexingReduce(table->indexing, hash, table->old.max);
+    size_t home_offset = (i >= table->old.first)
+                             ? i - table->old.first
+                             : i + table->old.max - table->old.first;
+    size_t curr_psl = 1;
+    if (home_offset < table->old.done) {
+        curr_psl += table->old.done - home_offset;
+        i = table->old.cursor;
+    }
+    while (curr_psl <= psls[i]) {
+        HT_COUNT(table, probes, 1);
+        if (buckets[i].hash == hash) {
+            HT_COUNT(table, compares, 1);
+            if (table->comp_key(buckets[i].key, key) == 0) {
+                *idx = i;
+                return true;
+            }
+        }
+        i = HTIndexingNext(table->indexing, i, table->old.max);
+        curr_psl++;
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *  Adds the probe sequence lengths of an array of buckets to the histogram,
+ *  max probe and probe sum of the stats.
+ */
+static void _addPslStats(const unsigned char *psls, size_t max_count,
+                         HTStats_t *stats, size_t *probe_sum)
+{
+    for (size_t i = 0; i < max_count; i++) {
+        if (psls[i] == 0) {
+            continue;
+        }
+        HTStatsAddBin(stats->histogram, psls[i] - 1, 1);
+        *probe_sum += psls[i];
+        if (psls[i] > stats->max_probe) {
+            stats->max_probe = psls[i];
+        }
+    }
+}
+
+/**
+ * @brief
+ *  Calls func on each entry of the current or old buckets whose home bucket
+ *  is home, which all sit in the probe sequence starting there. In the old
+ *  buckets the migrated part of that sequence is skipped, as in
+ *  _findOldBucket.
+ */
+static void _scanHome(RobinHashTable_t *table, bool is_old, size_t home,
+                      void (*func)(void *, void *, void *), void *arg)
+{
+    RobinHTBucket_t *buckets = table->buckets;
+    unsigned char *psls = table->psls;
+    size_t max_count = table->count.max;
+    size_t i = home;
+    size_t curr_psl = 1;
+    if (is_old) {
+        buckets = table->old.buckets;
+        psls = table->old.psls;
+        max_count = table->old.max;
+        size_t home_offset = (home >= table->old.first)
+                                 ? home - table->old.first
+                                 : home + max_count - table->old.first;
+        if (home_offset < table->old.done) {
+            curr_psl += table->old.done - home_offset;
+            i = table->old.cursor;
+        }
+    }
+    for (; curr_psl <= psls[i]; curr_psl++) {
+        if (psls[i] == curr_psl) {
+            func(buckets[i].key, buckets[i].data, arg);
         }
-        curr_bucket->psl += 1;
+        i = HTIndexingNext(table->indexing, i, max_count);
     }
-    buckets[i] = curr_bucket;
+}
+
+/**
+ * @brief
+ *  Sets the number of buckets and the count of used buckets at which adds
+ *  rehash, max_load * max_count rounded up so an add only compares integers.
+ */
+static void _setMaxCount(RobinHashTable_t *table, size_t max_count)
+{
+    table->count.max = max_count;
+    table->count.limit = robinSlotsLimit(table->max_load, max_count);
+}
+
+/**
+ * @brief
+ *  Gets the bucket count an add grows the table to, as robinSlotsGrownCount.
+ */
+static size_t _grownCount(const RobinHashTable_t *table)
+{
+    return robinSlotsGrownCount(table->count.max, sizeof(RobinHTBucket_t));
+}
+
+/**
+ * @brief
+ *  Checks whether growing could help an add, as robinSlotsIsWorthGrowing.
+ */
+static bool _isWorthGrowing(const RobinHashTable_t *table)
+{
+    return robinSlotsIsWorthGrowing(table->count.used, table->count.max);
+}
+
+/**
+ * @brief
+ *  Removes a bucket for RobinHashTableRemoveIf if its entry matches the
+ *  predicate, freeing its data and key if given functions to do so.
+ */
+static bool _takeIf(RobinHTBucket_t *bucket, void *arg)
+{
+    RobinHTTakeIf_t *take_if = arg;
+    if (!take_if->pred(bucket->key, bucket->data, take_if->arg)) {
+        return false;
+    }
+    if (take_if->free_data != NULL) {
+        take_if->free_data(bucket->data);
+    }
+    if (take_if->free_key != NULL) {
+        take_if->free_key(bucket->key);
+    }
+    return true;
 }
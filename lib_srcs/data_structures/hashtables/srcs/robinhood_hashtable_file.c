@@ -0,0 +1,252 @@
+/**
+ * @file robinhood_hashtable_file.c
+ *
+ * @brief
+ *  Structs and functions for a flat, read-only robinhood hashtable file
+ *  format.
+ *
+ * @implements
+ *  robinhood_hashtable_file.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "robinhood_hashtable_file.h"
+#include "_robinhood_slots.h"
+#include "hash_funcs.h"
+#include "hashtable_index.h"
+#include <assert.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+defRobinSlots(robinHTFileSlots, RobinHTFileSlot_t)
+
+static bool _placeSlots(const RobinHashTable_t *table,
+                        size_t (*key_size)(const void *),
+                        size_t (*data_size)(const void *),
+                        RobinHTFileHeader_t *header, RobinHTFileSlot_t *slots,
+                        unsigned char *psls);
+static bool _isValid(const unsigned char *bytes, size_t size);
+static bool _isInFile(const RobinHTFile_t *file, uint64_t off, uint64_t len);
+
+bool RobinHashTableWriteBinary(const RobinHashTable_t *table,
+                               size_t (*key_size)(const void *),
+                               size_t (*data_size)(const void *),
+                               FILE *file_dest)
+{
+    assert(table != NULL);
+    assert(key_size != NULL);
+    assert(data_size != NULL);
+    assert(file_dest != NULL);
+
+    RobinHTFileHeader_t header = {.magic = ROBIN_HT_FILE_MAGIC,
+                                  .version = ROBIN_HT_FILE_VERSION,
+                                  .order = ROBIN_HT_FILE_ORDER,
+                                  .entry_count = table->count.used,
+                                  .seed = ROBIN_HT_FILE_SEED};
+    size_t slot_count = HTIndexingRound(
+        HT_INDEX_MASK, (size_t)(table->count.used / ROBIN_HT_FILE_LOAD) + 1);
+    RobinHTFileSlot_t *slots;
+    unsigned char *psls;
+    while (true) {
+        slots = calloc(slot_count, sizeof(RobinHTFileSlot_t));
+        psls = calloc(slot_count, sizeof(unsigned char));
+        if (slots == NULL || psls == NULL) {
+            free(slots);
+            free(psls);
+            return false;
+        }
+        header.slot_count = slot_count;
+        header.slots_off = sizeof(RobinHTFileHeader_t);
+        header.psls_off
+            = header.slots_off + slot_count * sizeof(RobinHTFileSlot_t);
+        header.heap_off = header.psls_off + slot_count;
+        if (_placeSlots(table, key_size, data_size, &header, slots, psls)) {
+            break;
+        }
+        free(slots);
+        free(psls);
+        if (header.file_size == 0) { // a key or data is too large
+            return false;
+        }
+        // a probe sequence past ROBIN_HT_MAX_PSL is retried with more slots,
+        // unless the slots are already under 1/8 full, where it comes from
+        // keys hashing alike rather than from the load
+        if (table->count.used <= slot_count / 8
+            || slot_count > SIZE_MAX / 2 / sizeof(RobinHTFileSlot_t)) {
+            return false;
+        }
+        slot_count *= 2;
+    }
+    bool is_written
+        = fwrite(&header, sizeof(RobinHTFileHeader_t), 1, file_dest) == 1
+          && fwrite(slots, sizeof(RobinHTFileSlot_t), slot_count, file_dest)
+                 == slot_count
+          && fwrite(psls, sizeof(unsigned char), slot_count, file_dest)
+                 == slot_count;
+    free(slots);
+    free(psls);
+    // the heap is written in the same order _placeSlots laid it out in
+    RobinHTIter_t iter;
+    RobinHashTableIterBegin(table, &iter);
+    while (is_written && RobinHashTableIterNext(table, &iter)) {
+        size_t key_len = key_size(iter.key);
+        size_t data_len = data_size(iter.data);
+        is_written = (key_len == 0
+                      || fwrite(iter.key, 1, key_len, file_dest) == key_len)
+                     && (data_len == 0
+                         || fwrite(iter.data, 1, data_len, file_dest)
+                                == data_len);
+    }
+    return is_written;
+}
+
+RobinHTFile_t *RobinHTFileOpen(const char *file_name)
+{
+    assert(file_name != NULL);
+
+    int fd = open(file_name, O_RDONLY);
+    if (fd == -1) {
+        return NULL;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == -1
+        || (size_t)file_stat.st_size < sizeof(RobinHTFileHeader_t)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = file_stat.st_size;
+    void *bytes = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if (bytes == MAP_FAILED) {
+        return NULL;
+    }
+    RobinHTFile_t *file = malloc(sizeof(RobinHTFile_t));
+    if (file == NULL || !_isValid(bytes, size)) {
+        free(file);
+        munmap(bytes, size);
+        return NULL;
+    }
+    file->bytes = bytes;
+    file->size = size;
+    file->header = bytes;
+    file->slots = (const void *)(file->bytes + file->header->slots_off);
+    file->psls = file->bytes + file->header->psls_off;
+    return file;
+}
+
+void RobinHTFileClose(RobinHTFile_t **p_file)
+{
+    assert(p_file != NULL);
+    assert(*p_file != NULL);
+
+    munmap((void *)(*p_file)->bytes, (*p_file)->size);
+    free(*p_file);
+    *p_file = NULL;
+}
+
+const void *RobinHTFileFind(const RobinHTFile_t *file, const void *key,
+                            size_t key_len, size_t *p_data_len)
+{
+    assert(file != NULL);
+    assert(key != NULL || key_len == 0);
+
+    size_t slot_count = file->header->slot_count;
+    uint64_t hash = wyHashSeeded(key, key_len, file->header->seed);
+    size_t i = HTIndexingReduce(HT_INDEX_MASK, hash, slot_count);
+    for (unsigned int psl = 1; psl <= file->psls[i]; psl++) {
+        const RobinHTFileSlot_t *slot = &file->slots[i];
+        if (slot->hash == hash && slot->key_len == key_len
+            && _isInFile(file, slot->key_off, slot->key_len)
+            && _isInFile(file, slot->data_off, slot->data_len)
+            && memcmp(file->bytes + slot->key_off, key, key_len) == 0) {
+            if (p_data_len != NULL) {
+                *p_data_len = slot->data_len;
+            }
+            return file->bytes + slot->data_off;
+        }
+        i = HTIndexingNext(HT_INDEX_MASK, i, slot_count);
+    }
+    return NULL;
+}
+
+/**
+ * @brief
+ *  Hashes every entry of the table into the slots, laying its key and data
+ *  out on the heap in iteration order and setting the header's file size.
+ *  Fails with the file size left at 0 if a key or data is too large, or
+ *  with it set if a probe sequence grows past ROBIN_HT_MAX_PSL.
+ */
+static bool _placeSlots(const RobinHashTable_t *table,
+                        size_t (*key_size)(const void *),
+                        size_t (*data_size)(const void *),
+                        RobinHTFileHeader_t *header, RobinHTFileSlot_t *slots,
+                        unsigned char *psls)
+{
+    header->file_size = 0;
+    uint64_t heap_end = header->heap_off;
+    RobinHTIter_t iter;
+    RobinHashTableIterBegin(table, &iter);
+    while (RobinHashTableIterNext(table, &iter)) {
+        size_t key_len = key_size(iter.key);
+        size_t data_len = data_size(iter.data);
+        if (key_len > UINT32_MAX || data_len > UINT32_MAX) {
+            return false;
+        }
+        RobinHTFileSlot_t new_slot
+            = {.hash = wyHashSeeded(iter.key, key_len, header->seed),
+               .key_off = heap_end,
+               .data_off = heap_end + key_len,
+               .key_len = key_len,
+               .data_len = data_len};
+        heap_end += key_len + data_len;
+        size_t i = HTIndexingReduce(HT_INDEX_MASK, new_slot.hash,
+                                    header->slot_count);
+        if (!robinHTFileSlotsAdd(slots, psls, new_slot, i, header->slot_count,
+                                 HT_INDEX_MASK)) {
+            header->file_size = heap_end;
+            return false;
+        }
+    }
+    header->file_size = heap_end;
+    return true;
+}
+
+/**
+ * @brief
+ *  Checks the header of a mapped file and that the slots and probe sequence
+ *  lengths it describes fit within the file.
+ */
+static bool _isValid(const unsigned char *bytes, size_t size)
+{
+    const RobinHTFileHeader_t *header = (const void *)bytes;
+    uint64_t slot_count = header->slot_count;
+    return memcmp(header->magic, ROBIN_HT_FILE_MAGIC,
+                  sizeof(ROBIN_HT_FILE_MAGIC))
+                   == 0
+           && header->version == ROBIN_HT_FILE_VERSION
+           && header->order == ROBIN_HT_FILE_ORDER
+           && header->file_size == size && slot_count != 0
+           && (slot_count & (slot_count - 1)) == 0
+           && slot_count <= size / sizeof(RobinHTFileSlot_t)
+           && header->slots_off % sizeof(uint64_t) == 0
+           && header->slots_off <= size
+           && slot_count * sizeof(RobinHTFileSlot_t)
+                  <= size - header->slots_off
+           && header->psls_off <= size
+           && slot_count <= size - header->psls_off;
+}
+
+/**
+ * @brief
+ *  Checks that len bytes at offset off lie within the file.
+ */
+static bool _isInFile(const RobinHTFile_t *file, uint64_t off, uint64_t len)
+{
+    return off <= file->size && len <= file->size - off;
+}
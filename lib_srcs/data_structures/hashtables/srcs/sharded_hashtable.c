@@ -0,0 +1,146 @@
+/**
+ * @file sharded_hashtable.c
+ *
+ * @brief
+ *  Structs and functions for thread-safe sharded hashtables.
+ *
+ * @implements
+ *  sharded_hashtable.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "sharded_hashtable.h"
+#include "hash_funcs.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// xored into a hash before it's mixed to pick a shard, so the shard index
+// stays independent of the bits the shards' own indexing looks at
+#define SHARD_SALT ((size_t)0x9E3779B97F4A7C15ull)
+
+static void _destroyShards(ShardHTShard_t *shards, size_t count,
+                           void (*free_data)(void *),
+                           void (*free_key)(void *));
+static ShardHTShard_t *_getShard(ShardHashTable_t *table, const void *key);
+
+ShardHashTable_t *
+ShardHashTableCreate(size_t shard_count, size_t bucket_count,
+                     float max_load_prop, HTIndexing_t indexing,
+                     size_t (*hash_func)(const void *),
+                     int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    ShardHashTable_t *new_table = malloc(sizeof(ShardHashTable_t));
+    if (new_table == NULL) {
+        return NULL;
+    }
+    new_table->shard_count = 1;
+    new_table->shard_shift = sizeof(size_t) * CHAR_BIT;
+    while (new_table->shard_count < shard_count) {
+        new_table->shard_count *= 2;
+        new_table->shard_shift -= 1;
+    }
+    new_table->hash = hash_func;
+    new_table->shards = aligned_alloc(
+        SHARD_HT_ALIGN, new_table->shard_count * sizeof(ShardHTShard_t));
+    if (new_table->shards == NULL) {
+        free(new_table);
+        return NULL;
+    }
+    for (size_t i = 0; i < new_table->shard_count; i++) {
+        ShardHTShard_t *shard = &new_table->shards[i];
+        shard->table = RobinHashTableCreate(bucket_count, max_load_prop,
+                                            indexing, hash_func, comp_key);
+        if (shard->table != NULL
+            && pthread_rwlock_init(&shard->lock, NULL) != 0) {
+            RobinHashTableClear(&shard->table, NULL, NULL);
+        }
+        if (shard->table == NULL) {
+            _destroyShards(new_table->shards, i, NULL, NULL);
+            free(new_table);
+            return NULL;
+        }
+    }
+    return new_table;
+}
+
+void ShardHashTableClear(ShardHashTable_t **p_table, void (*free_data)(void *),
+                         void (*free_key)(void *))
+{
+    assert(p_table != NULL);
+    assert(*p_table != NULL);
+
+    _destroyShards((*p_table)->shards, (*p_table)->shard_count, free_data,
+                   free_key);
+    free(*p_table);
+    *p_table = NULL;
+}
+
+bool ShardHashTableAdd(ShardHashTable_t *table, void *key, void *data)
+{
+    assert(table != NULL);
+
+    ShardHTShard_t *shard = _getShard(table, key);
+    pthread_rwlock_wrlock(&shard->lock);
+    bool is_added = RobinHashTableAdd(shard->table, key, data);
+    pthread_rwlock_unlock(&shard->lock);
+    return is_added;
+}
+
+void *ShardHashTableRemove(ShardHashTable_t *table, void *key,
+                           void (*free_key)(void *))
+{
+    assert(table != NULL);
+
+    ShardHTShard_t *shard = _getShard(table, key);
+    pthread_rwlock_wrlock(&shard->lock);
+    void *data = RobinHashTableRemove(shard->table, key, free_key);
+    pthread_rwlock_unlock(&shard->lock);
+    return data;
+}
+
+void *ShardHashTableFind(ShardHashTable_t *table, void *key)
+{
+    assert(table != NULL);
+
+    ShardHTShard_t *shard = _getShard(table, key);
+    pthread_rwlock_rdlock(&shard->lock);
+    void *data = RobinHashTableFind(shard->table, key);
+    pthread_rwlock_unlock(&shard->lock);
+    return data;
+}
+
+/**
+ * @brief
+ *  Clears the tables and destroys the locks of the first count shards, then
+ *  frees the shards.
+ */
+static void _destroyShards(ShardHTShard_t *shards, size_t count,
+                           void (*free_data)(void *), void (*free_key)(void *))
+{
+    for (size_t i = 0; i < count; i++) {
+        pthread_rwlock_destroy(&shards[i].lock);
+        RobinHashTableClear(&shards[i].table, free_data, free_key);
+    }
+    free(shards);
+}
+
+/**
+ * @brief
+ *  Gets the shard of a key from the high bits of its mixed hash.
+ */
+static ShardHTShard_t *_getShard(ShardHashTable_t *table, const void *key)
+{
+    if (table->shard_count == 1) {
+        return &table->shards[0];
+    }
+    size_t hash = mixHash(table->hash(key) ^ SHARD_SALT);
+    return &table->shards[hash >> table->shard_shift];
+}
@@ -0,0 +1,368 @@
+/**
+ * @file swiss_hashtable.c
+ *
+ * @brief
+ *  Structs and functions for swiss open address hashtables.
+ *
+ * @implements
+ *  swiss_hashtable.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "swiss_hashtable.h"
+#include "hash_funcs.h"
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define CTRL_EMPTY ((signed char)-128)
+#define CTRL_DELETED ((signed char)-2)
+
+typedef uint32_t GroupMask_t; // bit i set if slot i of the group matched
+
+static void _allocSlots(size_t count, signed char **p_ctrls,
+                        SwissHTSlot_t **p_slots);
+static size_t _roundCount(size_t count);
+static GroupMask_t _matchTag(const signed char *group, signed char tag);
+static GroupMask_t _matchEmpty(const signed char *group);
+static GroupMask_t _matchFree(const signed char *group);
+static unsigned int _lowestBit(GroupMask_t mask);
+static unsigned int _leadingZeros(GroupMask_t mask);
+static void _setCtrl(signed char *ctrls, size_t i, signed char ctrl,
+                     size_t max_count);
+static size_t _findFree(const signed char *ctrls, size_t hash,
+                        size_t max_count);
+static bool _findSlot(SwissHashTable_t *table, const void *key, size_t *idx);
+
+SwissHashTable_t *
+SwissHashTableCreate(size_t bucket_count, float max_load_prop,
+                     size_t (*hash_func)(const void *),
+                     int (*comp_key)(const void *, const void *))
+{
+    assert(hash_func != NULL);
+    assert(comp_key != NULL);
+
+    SwissHashTable_t *new_table = calloc(1, sizeof(SwissHashTable_t));
+    if (new_table == NULL) {
+        return NULL;
+    }
+    new_table->count.max = _roundCount(bucket_count);
+    new_table->max_load = max_load_prop;
+    new_table->hash = hash_func;
+    new_table->comp_key = comp_key;
+    _allocSlots(new_table->count.max, &new_table->ctrls, &new_table->slots);
+    if (new_table->ctrls == NULL) {
+        free(new_table);
+        return NULL;
+    }
+    return new_table;
+}
+
+void SwissHashTableClear(SwissHashTable_t **p_table,
+                         void (*free_data)(void *), void (*free_key)(void *))
+{
+    assert(p_table != NULL);
+    assert(*p_table != NULL);
+
+    SwissHTSlot_t *slots = (*p_table)->slots;
+    for (size_t i = 0; i < (*p_table)->count.max; i++) {
+        if ((*p_table)->ctrls[i] < 0) {
+            continue;
+        }
+        if (free_data != NULL) {
+            free_data(slots[i].data);
+        }
+        if (free_key != NULL) {
+            free_key(slots[i].key);
+        }
+    }
+    free(slots);
+    free((*p_table)->ctrls);
+    free(*p_table);
+    *p_table = NULL;
+}
+
+bool SwissHashTableAdd(SwissHashTable_t *table, void *key, void *data)
+{
+    assert(table != NULL);
+
+    size_t load = table->count.used + table->count.deleted;
+    if (table->max_load == 0) {
+        // without rehashing deleted slots are never dropped, so they're
+        // reused by _findFree and only the used slots count as load
+        if (table->count.used >= table->count.max) {
+            return false;
+        }
+    } else if ((float)load / table->count.max >= table->max_load
+               || load >= table->count.max) {
+        // only grow if the load isn't mostly deleted slots
+        size_t new_count = table->count.max;
+        if (table->count.used >= table->max_load * table->count.max / 2) {
+            new_count *= 2;
+        }
+        if (SwissHashTableRehash(table, new_count) != 1) {
+            return false;
+        }
+    }
+    size_t hash = mixHash(table->hash(key));
+    size_t i = _findFree(table->ctrls, hash, table->count.max);
+    if (table->ctrls[i] == CTRL_DELETED) {
+        table->count.deleted -= 1;
+    }
+    _setCtrl(table->ctrls, i, hash & 0x7F, table->count.max);
+    table->slots[i].key = key;
+    table->slots[i].data = data;
+    table->count.used += 1;
+    return true;
+}
+
+void *SwissHashTableRemove(SwissHashTable_t *table, void *key,
+                           void (*free_key)(void *))
+{
+    assert(table != NULL);
+
+    size_t i;
+    if (!_findSlot(table, key, &i)) {
+        return NULL;
+    }
+    void *data = table->slots[i].data;
+    if (free_key != NULL) {
+        free_key(table->slots[i].key);
+    }
+    // a slot can only go back to empty if no probe has ever seen it inside a
+    // full group, otherwise the probe would stop short of keys past it
+    size_t mask = table->count.max - 1;
+    GroupMask_t empty_before
+        = _matchEmpty(&table->ctrls[(i - SWISS_HT_GROUP_WIDTH) & mask]);
+    GroupMask_t empty_after = _matchEmpty(&table->ctrls[i]);
+    if (empty_before != 0 && empty_after != 0
+        && _lowestBit(empty_after) + _leadingZeros(empty_before)
+               < SWISS_HT_GROUP_WIDTH) {
+        _setCtrl(table->ctrls, i, CTRL_EMPTY, table->count.max);
+    } else {
+        _setCtrl(table->ctrls, i, CTRL_DELETED, table->count.max);
+        table->count.deleted += 1;
+    }
+    table->count.used -= 1;
+    return data;
+}
+
+void *SwissHashTableFind(SwissHashTable_t *table, void *key)
+{
+    assert(table != NULL);
+
+    size_t i;
+    if (!_findSlot(table, key, &i)) {
+        return NULL;
+    }
+    return table->slots[i].data;
+}
+
+int SwissHashTableRehash(SwissHashTable_t *table, size_t new_count)
+{
+    assert(table != NULL);
+
+    new_count = _roundCount(new_count);
+    float max_load = table->max_load;
+    if (max_load == 0) {
+        max_load = 1;
+    }
+    if (max_load * new_count < table->count.used) {
+        return -1;
+    }
+    signed char *new_ctrls;
+    SwissHTSlot_t *new_slots;
+    _allocSlots(new_count, &new_ctrls, &new_slots);
+    if (new_ctrls == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < table->count.max; i++) {
+        if (table->ctrls[i] < 0) {
+            continue;
+        }
+        size_t hash = mixHash(table->hash(table->slots[i].key));
+        size_t new_i = _findFree(new_ctrls, hash, new_count);
+        _setCtrl(new_ctrls, new_i, hash & 0x7F, new_count);
+        new_slots[new_i] = table->slots[i];
+    }
+    free(table->ctrls);
+    free(table->slots);
+    table->ctrls = new_ctrls;
+    table->slots = new_slots;
+    table->count.max = new_count;
+    table->count.deleted = 0;
+    return 1;
+}
+
+/**
+ * @brief
+ *  Allocates the control bytes, all set to empty, and the slots of a table.
+ *  Both pointers are set to NULL if unable to allocate memory.
+ */
+static void _allocSlots(size_t count, signed char **p_ctrls,
+                        SwissHTSlot_t **p_slots)
+{
+    *p_ctrls = malloc(count + SWISS_HT_GROUP_WIDTH);
+    *p_slots = malloc(count * sizeof(SwissHTSlot_t));
+    if (*p_ctrls == NULL || *p_slots == NULL) {
+        free(*p_ctrls);
+        free(*p_slots);
+        *p_ctrls = NULL;
+        *p_slots = NULL;
+        return;
+    }
+    memset(*p_ctrls, CTRL_EMPTY, count + SWISS_HT_GROUP_WIDTH);
+}
+
+/**
+ * @brief
+ *  Rounds a slot count up to a power of 2 no less than one group.
+ */
+static size_t _roundCount(size_t count)
+{
+    size_t rounded = SWISS_HT_GROUP_WIDTH;
+    while (rounded < count) {
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+#if defined(__SSE2__)
+static GroupMask_t _matchTag(const signed char *group, signed char tag)
+{
+    __m128i ctrls = _mm_loadu_si128((const __m128i *)group);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrls, _mm_set1_epi8(tag)));
+}
+
+static GroupMask_t _matchEmpty(const signed char *group)
+{
+    return _matchTag(group, CTRL_EMPTY);
+}
+
+static GroupMask_t _matchFree(const signed char *group)
+{
+    __m128i ctrls = _mm_loadu_si128((const __m128i *)group);
+    return _mm_movemask_epi8(ctrls); // only empty and deleted are negative
+}
+#else
+static GroupMask_t _matchTag(const signed char *group, signed char tag)
+{
+    GroupMask_t mask = 0;
+    for (unsigned int i = 0; i < SWISS_HT_GROUP_WIDTH; i++) {
+        mask |= (GroupMask_t)(group[i] == tag) << i;
+    }
+    return mask;
+}
+
+static GroupMask_t _matchEmpty(const signed char *group)
+{
+    return _matchTag(group, CTRL_EMPTY);
+}
+
+static GroupMask_t _matchFree(const signed char *group)
+{
+    GroupMask_t mask = 0;
+    for (unsigned int i = 0; i < SWISS_HT_GROUP_WIDTH; i++) {
+        mask |= (GroupMask_t)(group[i] < 0) << i;
+    }
+    return mask;
+}
+#endif
+
+static unsigned int _lowestBit(GroupMask_t mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    unsigned int i = 0;
+    for (; (mask & 1) == 0; mask >>= 1) {
+        i++;
+    }
+    return i;
+#endif
+}
+
+/**
+ * @brief
+ *  Counts the leading zeros within the SWISS_HT_GROUP_WIDTH bits of a mask.
+ */
+static unsigned int _leadingZeros(GroupMask_t mask)
+{
+    unsigned int count = 0;
+    for (GroupMask_t bit = (GroupMask_t)1 << (SWISS_HT_GROUP_WIDTH - 1);
+         bit != 0 && (mask & bit) == 0; bit >>= 1) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief
+ *  Sets the control byte of slot i, and its copy past the end if it has one.
+ */
+static void _setCtrl(signed char *ctrls, size_t i, signed char ctrl,
+                     size_t max_count)
+{
+    ctrls[i] = ctrl;
+    if (i < SWISS_HT_GROUP_WIDTH) {
+        ctrls[max_count + i] = ctrl;
+    }
+}
+
+/**
+ * @brief
+ *  Finds the first empty or deleted slot along the probe sequence of a hash.
+ *  The table must have at least one such slot.
+ */
+static size_t _findFree(const signed char *ctrls, size_t hash,
+                        size_t max_count)
+{
+    size_t mask = max_count - 1;
+    size_t pos = (hash >> 7) & mask;
+    for (size_t step = SWISS_HT_GROUP_WIDTH;; step += SWISS_HT_GROUP_WIDTH) {
+        GroupMask_t free_slots = _matchFree(&ctrls[pos]);
+        if (free_slots != 0) {
+            return (pos + _lowestBit(free_slots)) & mask;
+        }
+        pos = (pos + step) & mask;
+    }
+}
+
+/**
+ * @brief
+ *  Finds the slot holding a key.
+ *
+ * @return
+ *  true  : key found, its slot is stored in idx @n
+ *  false : key not found @n
+ */
+static bool _findSlot(SwissHashTable_t *table, const void *key, size_t *idx)
+{
+    size_t hash = mixHash(table->hash(key));
+    signed char tag = hash & 0x7F;
+    size_t mask = table->count.max - 1;
+    size_t pos = (hash >> 7) & mask;
+    for (size_t step = SWISS_HT_GROUP_WIDTH; step <= table->count.max;
+         step += SWISS_HT_GROUP_WIDTH) {
+        const signed char *group = &table->ctrls[pos];
+        for (GroupMask_t matches = _matchTag(group, tag); matches != 0;
+             matches &= matches - 1) {
+            size_t i = (pos + _lowestBit(matches)) & mask;
+            if (table->comp_key(table->slots[i].key, key) == 0) {
+                *idx = i;
+                return true;
+            }
+        }
+        if (_matchEmpty(group) != 0) {
+            return false;
+        }
+        pos = (pos + step) & mask;
+    }
+    return false;
+}
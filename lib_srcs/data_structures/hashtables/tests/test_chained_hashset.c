@@ -0,0 +1,204 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "chained_hashset.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+
+/**
+ * @brief
+ *  Gets the i-th key, a small integer kept in the pointer itself.
+ */
+static void *_key(size_t i)
+{
+    return (void *)(uintptr_t)(i + 1);
+}
+
+/**
+ * @brief
+ *  Creates a set of the keys in the first half, or of every third key.
+ */
+static ChainHashSet_t *_createSet(bool is_thirds)
+{
+    ChainHashSet_t *set
+        = ChainHashSetCreate(16, 1, 0.25, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (is_thirds ? i % 3 == 0 : i < KEY_COUNT / 2) {
+            ChainHashSetAdd(set, _key(i));
+        }
+    }
+    return set;
+}
+
+/**
+ * @brief
+ *  Checks that a set holds exactly the keys expected by is_in, printing the
+ *  ones that differ.
+ */
+static bool _checkSet(const ChainHashSet_t *set, bool (*is_in)(size_t),
+                      const char *op)
+{
+    bool is_ok = true;
+    size_t count = 0;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        bool res = ChainHashSetContains(set, _key(i));
+        count += is_in(i);
+        if (res != is_in(i)) {
+            is_ok = false;
+            printf("%s: %lu \t->\t res: %d | ans: %d\n", op, i, res, is_in(i));
+        }
+    }
+    if (set->count != count) {
+        is_ok = false;
+        printf("%s: count \t->\t res: %lu | ans: %lu\n", op, set->count,
+               count);
+    }
+    return is_ok;
+}
+
+static bool _isInUnion(size_t i)
+{
+    return i < KEY_COUNT / 2 || i % 3 == 0;
+}
+
+static bool _isInIntersect(size_t i)
+{
+    return i < KEY_COUNT / 2 && i % 3 == 0;
+}
+
+static bool _isInDifference(size_t i)
+{
+    return i < KEY_COUNT / 2 && i % 3 != 0;
+}
+
+static bool _isInNone(size_t i)
+{
+    (void)i;
+    return false;
+}
+
+static bool _test_ChainHashSetAddContainsRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    HTIndexing_t policies[] = {HT_INDEX_MOD, HT_INDEX_MASK, HT_INDEX_MULSHIFT};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(HTIndexing_t); p++) {
+        ChainHashSet_t *set
+            = ChainHashSetCreate(100, 1, 0.25, policies[p], ptrHash, compPtr);
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            int res = ChainHashSetAdd(set, _key(i));
+            if (res != 1) {
+                is_ok = false;
+                printf("policy %lu: add: %lu \t->\t res: %d | ans: 1\n", p, i,
+                       res);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i += 2) {
+            int res = ChainHashSetAdd(set, _key(i));
+            if (res != 0) {
+                is_ok = false;
+                printf("policy %lu: re-add: %lu \t->\t res: %d | ans: 0\n", p,
+                       i, res);
+            }
+            if (!ChainHashSetRemove(set, _key(i), NULL)) {
+                is_ok = false;
+                printf("policy %lu: remove: %lu \t->\t failed\n", p, i);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            bool res = ChainHashSetContains(set, _key(i));
+            if (res != (i % 2 == 1)) {
+                is_ok = false;
+                printf("policy %lu: contains: %lu \t->\t res: %d | ans: %d\n",
+                       p, i, res, i % 2 == 1);
+            }
+        }
+        if (ChainHashSetRemove(set, _key(0), NULL)) {
+            is_ok = false;
+            printf("policy %lu: remove missing: res: true | ans: false\n", p);
+        }
+        ChainHashSetClear(&set, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashSetUnion()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashSet_t *set = _createSet(false);
+    ChainHashSet_t *other = _createSet(true);
+    if (!ChainHashSetUnion(set, other)) {
+        is_ok = false;
+        printf("union: failed\n");
+    }
+    is_ok &= _checkSet(set, _isInUnion, "union");
+    ChainHashSetUnion(set, set);
+    is_ok &= _checkSet(set, _isInUnion, "self union");
+    ChainHashSetClear(&other, NULL);
+    ChainHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashSetIntersect()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashSet_t *set = _createSet(false);
+    ChainHashSet_t *other = _createSet(true);
+    size_t removed = ChainHashSetIntersect(set, other, NULL);
+    size_t ans = KEY_COUNT / 2 - (KEY_COUNT / 2 + 2) / 3;
+    if (removed != ans) {
+        is_ok = false;
+        printf("intersect: removed \t->\t res: %lu | ans: %lu\n", removed,
+               ans);
+    }
+    is_ok &= _checkSet(set, _isInIntersect, "intersect");
+    ChainHashSetIntersect(set, set, NULL);
+    is_ok &= _checkSet(set, _isInIntersect, "self intersect");
+    ChainHashSetClear(&other, NULL);
+    ChainHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashSetDifference()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashSet_t *set = _createSet(false);
+    ChainHashSet_t *other = _createSet(true);
+    size_t removed = ChainHashSetDifference(set, other, NULL);
+    size_t ans = (KEY_COUNT / 2 + 2) / 3;
+    if (removed != ans) {
+        is_ok = false;
+        printf("difference: removed \t->\t res: %lu | ans: %lu\n", removed,
+               ans);
+    }
+    is_ok &= _checkSet(set, _isInDifference, "difference");
+    ChainHashSetDifference(set, set, NULL);
+    is_ok &= _checkSet(set, _isInNone, "self difference");
+    ChainHashSetClear(&other, NULL);
+    ChainHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_ChainHashSetAddContainsRemove();
+    is_ok &= _test_ChainHashSetUnion();
+    is_ok &= _test_ChainHashSetIntersect();
+    is_ok &= _test_ChainHashSetDifference();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,304 @@
+#include "chained_hashtable.h"
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_COUNT 2000
+
+static int values[KEY_COUNT];
+
+#define FLOOD_BLOCKS 8
+#define FLOOD_COUNT (1 << FLOOD_BLOCKS)
+
+static bool _test_ChainHashTableAddFindRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    HTIndexing_t policies[] = {HT_INDEX_MOD, HT_INDEX_MASK, HT_INDEX_MULSHIFT};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(HTIndexing_t); p++) {
+        ChainHashTable_t *table
+            = ChainHashTableCreate(100, 0, 0, policies[p], ptrHash, compPtr);
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            if (!ChainHashTableAdd(table, &values[i], &values[i])) {
+                is_ok = false;
+                printf("policy %lu: add: %lu \t->\t failed\n", p, i);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i += 2) {
+            int *res = ChainHashTableRemove(table, &values[i], NULL);
+            if (res != &values[i]) {
+                is_ok = false;
+                printf("policy %lu: remove: %lu \t->\t res: %p | ans: %p\n", p,
+                       i, res, &values[i]);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            int *res = ChainHashTableFind(table, &values[i]);
+            int *ans = (i % 2 == 0) ? NULL : &values[i];
+            if (res != ans) {
+                is_ok = false;
+                printf("policy %lu: find: %lu \t->\t res: %p | ans: %p\n", p,
+                       i, res, ans);
+            }
+        }
+        ChainHashTableClear(&table, NULL, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashTableResize()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashTable_t *table
+        = ChainHashTableCreate(4, 1, 0.25, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        ChainHashTableAdd(table, &values[i], &values[i]);
+    }
+    if (table->count != KEY_COUNT || table->length < KEY_COUNT) {
+        is_ok = false;
+        printf("grow: res: %lu, %lu | ans: %d, >= %d\n", table->count,
+               table->length, KEY_COUNT, KEY_COUNT);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (ChainHashTableFind(table, &values[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %lu \t->\t not found\n", i);
+        }
+    }
+    for (size_t i = 10; i < KEY_COUNT; i++) {
+        ChainHashTableRemove(table, &values[i], NULL);
+    }
+    if (table->count != 10 || table->length > 64) {
+        is_ok = false;
+        printf("shrink: res: %lu, %lu | ans: 10, <= 64\n", table->count,
+               table->length);
+    }
+    for (size_t i = 0; i < 10; i++) {
+        if (ChainHashTableFind(table, &values[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %lu \t->\t not found\n", i);
+        }
+    }
+    ChainHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static void _countSeen(void *key, void *data, void *arg)
+{
+    (void)key;
+    ((int *)arg)[(int *)data - values] += 1;
+}
+
+static bool _test_ChainHashTableIter()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashTable_t *table
+        = ChainHashTableCreate(64, 1, 0, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        ChainHashTableAdd(table, &values[i], &values[i]);
+    }
+    static int seen[KEY_COUNT];
+    memset(seen, 0, sizeof(seen));
+    ChainHTIter_t iter;
+    ChainHashTableIterBegin(table, &iter);
+    while (ChainHashTableIterNext(table, &iter)) {
+        _countSeen(iter.key, iter.data, seen);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (seen[i] != 1) {
+            is_ok = false;
+            printf("iter: %lu \t->\t res: %d | ans: 1\n", i, seen[i]);
+        }
+    }
+    ChainHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashTableScan()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashTable_t *table
+        = ChainHashTableCreate(4, 1, 0.25, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT / 2; i++) {
+        ChainHashTableAdd(table, &values[i], &values[i]);
+    }
+    static int seen[KEY_COUNT];
+    memset(seen, 0, sizeof(seen));
+    // grow the table under the scan, then shrink it back
+    size_t added = KEY_COUNT / 2;
+    size_t cursor = 0;
+    do {
+        cursor = ChainHashTableScan(table, cursor, 4, _countSeen, seen);
+        for (size_t i = 0; i < 8 && added < KEY_COUNT; i++, added++) {
+            ChainHashTableAdd(table, &values[added], &values[added]);
+        }
+    } while (cursor != 0);
+    for (size_t i = KEY_COUNT / 2; i < KEY_COUNT; i++) {
+        ChainHashTableRemove(table, &values[i], NULL);
+    }
+    size_t removed = KEY_COUNT / 4;
+    do {
+        cursor = ChainHashTableScan(table, cursor, 4, _countSeen, seen);
+        for (size_t i = 0; i < 8 && removed < KEY_COUNT / 2; i++, removed++) {
+            ChainHashTableRemove(table, &values[removed], NULL);
+        }
+    } while (cursor != 0);
+    for (size_t i = 0; i < KEY_COUNT / 4; i++) {
+        if (seen[i] < 2) {
+            is_ok = false;
+            printf("scan: %lu \t->\t res: %d | ans: >= 2\n", i, seen[i]);
+        }
+    }
+    ChainHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashTableFindBatch()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashTable_t *table
+        = ChainHashTableCreate(64, 1, 0, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        ChainHashTableAdd(table, &values[i], &values[i]);
+    }
+    void *batch_keys[KEY_COUNT + 1];
+    void *results[KEY_COUNT + 1];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        batch_keys[i] = &values[i];
+    }
+    batch_keys[KEY_COUNT] = "missing";
+    ChainHashTableFindBatch(table, batch_keys, KEY_COUNT + 1, results);
+    for (size_t i = 0; i <= KEY_COUNT; i++) {
+        int *ans = (i < KEY_COUNT && i % 2 == 0) ? &values[i] : NULL;
+        if (results[i] != ans) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, results[i],
+                   ans);
+        }
+    }
+    ChainHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashTableSeeded()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    // every string of FLOOD_BLOCKS "Ez" or "FY" blocks hashes the same by djb2
+    char flood_keys[FLOOD_COUNT][2 * FLOOD_BLOCKS + 1];
+    for (size_t i = 0; i < FLOOD_COUNT; i++) {
+        for (size_t b = 0; b < FLOOD_BLOCKS; b++) {
+            memcpy(&flood_keys[i][2 * b], (i >> b) & 1 ? "FY" : "Ez", 2);
+        }
+        flood_keys[i][2 * FLOOD_BLOCKS] = '\0';
+    }
+    ChainHashTable_t *tables[2] = {
+        ChainHashTableCreate(64, 1, 0, HT_INDEX_MASK, djb2Hash, compStr),
+        ChainHashTableCreateSeeded(64, 1, 0, HT_INDEX_MASK, sipStrHash,
+                                   compStr)};
+    for (size_t t = 0; t < 2; t++) {
+        for (size_t i = 0; i < FLOOD_COUNT; i++) {
+            ChainHashTableAdd(tables[t], flood_keys[i], &values[i]);
+        }
+    }
+    int longest[2] = {0, 0};
+    for (size_t t = 0; t < 2; t++) {
+        for (size_t i = 0; i < FLOOD_COUNT; i++) {
+            int length = ChainHashTableChainLength(tables[t], flood_keys[i]);
+            if (length > longest[t]) {
+                longest[t] = length;
+            }
+            if (ChainHashTableFind(tables[t], flood_keys[i]) != &values[i]) {
+                is_ok = false;
+                printf("table %lu: find: %s \t->\t not found\n", t,
+                       flood_keys[i]);
+            }
+        }
+    }
+    if (longest[0] != FLOOD_COUNT || longest[1] >= 16) {
+        is_ok = false;
+        printf("longest chain: res: %d, %d | ans: %d, < 16\n", longest[0],
+               longest[1], FLOOD_COUNT);
+    }
+    ChainHashTableClear(&tables[0], NULL, NULL);
+    ChainHashTableClear(&tables[1], NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ChainHashTableStats()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ChainHashTable_t *table
+        = ChainHashTableCreate(4, 1, 0, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        ChainHashTableAdd(table, &values[i], &values[i]);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        ChainHashTableFind(table, &values[i]);
+    }
+    HTStats_t stats;
+    ChainHashTableStats(table, &stats);
+    size_t buckets = 0;
+    size_t entries = 0;
+    for (size_t i = 0; i < HT_STATS_BINS; i++) {
+        buckets += stats.histogram[i];
+        entries += i * stats.histogram[i];
+    }
+    if (stats.entries != KEY_COUNT || entries != KEY_COUNT
+        || stats.buckets != table->length || buckets != table->length
+        || stats.load > 1) {
+        is_ok = false;
+        printf("shape: res: %lu, %lu, %lu, %f | ans: %d, %d, %lu, <= 1\n",
+               stats.entries, entries, buckets, stats.load, KEY_COUNT,
+               KEY_COUNT, table->length);
+    }
+    if (stats.mean_probe < 1 || stats.max_probe < stats.mean_probe
+        || stats.rehashes.count != 9) {
+        is_ok = false;
+        printf("probes: res: %f, %lu, %lu | ans: >= 1, >= mean, 9\n",
+               stats.mean_probe, stats.max_probe, stats.rehashes.count);
+    }
+#ifdef HT_STATS
+    if (stats.counters.lookups != KEY_COUNT
+        || stats.counters.probes < KEY_COUNT) {
+        is_ok = false;
+        printf("counters: res: %lu, %lu | ans: %d, >= %d\n",
+               stats.counters.lookups, stats.counters.probes, KEY_COUNT,
+               KEY_COUNT);
+    }
+#endif
+    ChainHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_ChainHashTableAddFindRemove();
+    is_ok &= _test_ChainHashTableResize();
+    is_ok &= _test_ChainHashTableIter();
+    is_ok &= _test_ChainHashTableScan();
+    is_ok &= _test_ChainHashTableFindBatch();
+    is_ok &= _test_ChainHashTableSeeded();
+    is_ok &= _test_ChainHashTableStats();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
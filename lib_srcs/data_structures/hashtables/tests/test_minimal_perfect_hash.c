@@ -0,0 +1,132 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "minimal_perfect_hash.h"
+#include "pointer_array.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_COUNT 20000
+#define MAX_CHAR 16
+
+static int values[KEY_COUNT];
+
+static char *_newKey(size_t i)
+{
+    char *key = malloc(MAX_CHAR);
+    snprintf(key, MAX_CHAR, "key_%lu", i);
+    return key;
+}
+
+static PointerArray_t *_keyArray(size_t count)
+{
+    PointerArray_t *arr = PointerArrayCreate(count);
+    for (size_t i = 0; i < count; i++) {
+        PointerArraySet(arr, i, _newKey(i), NULL);
+    }
+    return arr;
+}
+
+static bool _test_MinPerfHashIndex()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    PointerArray_t *arr = _keyArray(KEY_COUNT);
+    MinPerfHash_t *hash = MinPerfHashCreate(arr, 1, wyStrHashSeeded);
+    static bool is_taken[KEY_COUNT];
+    memset(is_taken, 0, sizeof(is_taken));
+    char key[MAX_CHAR];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, MAX_CHAR, "key_%lu", i);
+        size_t idx = MinPerfHashIndex(hash, key);
+        if (idx >= KEY_COUNT || is_taken[idx]) {
+            is_ok = false;
+            printf("index: %s \t->\t res: %lu | ans: unique < %d\n", key,
+                   idx, KEY_COUNT);
+            continue;
+        }
+        is_taken[idx] = true;
+    }
+    double bits_per_key
+        = (hash->level_offsets[hash->level_count]
+           + hash->level_offsets[hash->level_count] / 64
+                 / MIN_PERF_HASH_RANK_WORDS * 64)
+          / (double)KEY_COUNT;
+    if (bits_per_key > 4) {
+        is_ok = false;
+        printf("size: res: %f bits per key | ans: <= 4\n", bits_per_key);
+    }
+    MinPerfHashClear(&hash);
+    PointerArrayClear(&arr, free);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_MinPerfHashMapFind()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    PointerArray_t *arr = _keyArray(KEY_COUNT / 2);
+    PointerArray_t *data = PointerArrayCreate(KEY_COUNT / 2);
+    for (size_t i = 0; i < KEY_COUNT / 2; i++) {
+        PointerArraySet(data, i, &values[i], NULL);
+    }
+    MinPerfHashMap_t *map
+        = MinPerfHashMapCreate(arr, data, 2, sipStrHash, compStr);
+    char key[MAX_CHAR];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, MAX_CHAR, "key_%lu", i);
+        int *res = MinPerfHashMapFind(map, key);
+        int *ans = (i < KEY_COUNT / 2) ? &values[i] : NULL;
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %p\n", key, (void *)res,
+                   (void *)ans);
+        }
+    }
+    MinPerfHashMapClear(&map);
+    PointerArrayClear(&data, NULL);
+    PointerArrayClear(&arr, free);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_MinPerfHashInvalid()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    PointerArray_t *arr = _keyArray(100);
+    PointerArraySet(arr, 99, _newKey(5), free);
+    if (MinPerfHashCreate(arr, 1, wyStrHashSeeded) != NULL) {
+        is_ok = false;
+        printf("duplicate: res: built | ans: NULL\n");
+    }
+    PointerArrayClear(&arr, free);
+    arr = _keyArray(0);
+    MinPerfHashMap_t *map = MinPerfHashMapCreate(arr, NULL, 1,
+                                                 wyStrHashSeeded, compStr);
+    if (map == NULL || MinPerfHashMapFind(map, "key_0") != NULL) {
+        is_ok = false;
+        printf("empty: res: failed | ans: built, not found\n");
+    }
+    if (map != NULL) {
+        MinPerfHashMapClear(&map);
+    }
+    PointerArrayClear(&arr, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_MinPerfHashIndex();
+    is_ok &= _test_MinPerfHashMapFind();
+    is_ok &= _test_MinPerfHashInvalid();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
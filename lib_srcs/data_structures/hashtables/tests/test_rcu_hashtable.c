@@ -0,0 +1,183 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "rcu_hashtable.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+#define READER_COUNT 3
+#define WRITE_ROUNDS 20
+
+static int values[KEY_COUNT];
+
+typedef struct Reader {
+    RcuHashTable_t *table;
+    atomic_bool *is_done;
+    bool is_ok;
+} Reader_t;
+
+/**
+ * @brief
+ *  Looks up the odd keys, which are never removed, until the writer is done.
+ */
+static void *_read(void *arg)
+{
+    Reader_t *reader = arg;
+    reader->is_ok = true;
+    RcuHTReader_t *slot = RcuHashTableJoin(reader->table);
+    if (slot == NULL) {
+        reader->is_ok = false;
+        return NULL;
+    }
+    while (!atomic_load(reader->is_done)) {
+        for (size_t i = 1; i < KEY_COUNT; i += 2) {
+            reader->is_ok &= RcuHashTableFind(reader->table, slot, &values[i])
+                             == &values[i];
+        }
+    }
+    RcuHashTableLeave(reader->table, slot);
+    return NULL;
+}
+
+static bool _test_RcuHashTableAddFindRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RcuHashTable_t *table
+        = RcuHashTableCreate(8, 1, HT_INDEX_MASK, 1, ptrHash, compPtr);
+    RcuHTReader_t *slot = RcuHashTableJoin(table);
+    if (RcuHashTableJoin(table) != NULL) {
+        is_ok = false;
+        printf("join: res: not NULL | ans: NULL\n");
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (!RcuHashTableAdd(table, &values[i], &values[i])) {
+            is_ok = false;
+            printf("add: %lu \t->\t failed\n", i);
+        }
+    }
+    if (table->array->count < KEY_COUNT) {
+        is_ok = false;
+        printf("grow: res: %lu | ans: >= %d\n", table->array->count,
+               KEY_COUNT);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        if (!RcuHashTableRemove(table, &values[i], NULL, NULL)) {
+            is_ok = false;
+            printf("remove: %lu \t->\t res: not found | ans: removed\n", i);
+        }
+    }
+    if (RcuHashTableRemove(table, &values[0], NULL, NULL)) {
+        is_ok = false;
+        printf("remove again: 0 \t->\t res: removed | ans: not found\n");
+    }
+    if (table->count != KEY_COUNT / 2 || table->retired != NULL) {
+        is_ok = false;
+        printf("count: res: %lu, %p | ans: %d, NULL\n", table->count,
+               (void *)table->retired, KEY_COUNT / 2);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = RcuHashTableFind(table, slot, &values[i]);
+        int *ans = (i % 2 == 0) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, res, ans);
+        }
+    }
+    RcuHashTableLeave(table, slot);
+    RcuHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static size_t freed_count = 0;
+
+static void _countFree(void *data)
+{
+    (void)data;
+    freed_count += 1;
+}
+
+static bool _test_RcuHashTableRemoveFreeData()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RcuHashTable_t *table
+        = RcuHashTableCreate(8, 1, HT_INDEX_MASK, 1, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RcuHashTableAdd(table, &values[i], &values[i]);
+    }
+    freed_count = 0;
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        RcuHashTableRemove(table, &values[i], _countFree, NULL);
+    }
+    // with no reader in a find, removed data is freed right away
+    if (freed_count != KEY_COUNT / 2 || table->retired != NULL) {
+        is_ok = false;
+        printf("freed: res: %lu | ans: %d\n", freed_count, KEY_COUNT / 2);
+    }
+    RcuHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RcuHashTableThreads()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RcuHashTable_t *table = RcuHashTableCreate(8, 1, HT_INDEX_MASK,
+                                               READER_COUNT, ptrHash, compPtr);
+    for (size_t i = 1; i < KEY_COUNT; i += 2) {
+        RcuHashTableAdd(table, &values[i], &values[i]);
+    }
+    atomic_bool is_done = false;
+    pthread_t threads[READER_COUNT];
+    Reader_t readers[READER_COUNT];
+    for (size_t t = 0; t < READER_COUNT; t++) {
+        readers[t] = (Reader_t){.table = table, .is_done = &is_done};
+        pthread_create(&threads[t], NULL, _read, &readers[t]);
+    }
+    // churn the even keys, growing the table more than once on the way
+    for (size_t round = 0; round < WRITE_ROUNDS; round++) {
+        for (size_t i = 0; i < KEY_COUNT; i += 2) {
+            RcuHashTableAdd(table, &values[i], &values[i]);
+        }
+        for (size_t i = 0; i < KEY_COUNT; i += 2) {
+            if (!RcuHashTableRemove(table, &values[i], NULL, NULL)) {
+                is_ok = false;
+                printf("remove: %lu \t->\t failed\n", i);
+            }
+        }
+    }
+    atomic_store(&is_done, true);
+    for (size_t t = 0; t < READER_COUNT; t++) {
+        pthread_join(threads[t], NULL);
+        if (!readers[t].is_ok) {
+            is_ok = false;
+            printf("reader %lu: res: failed | ans: ok\n", t);
+        }
+    }
+    if (table->count != KEY_COUNT / 2) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", table->count, KEY_COUNT / 2);
+    }
+    RcuHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_RcuHashTableAddFindRemove();
+    is_ok &= _test_RcuHashTableRemoveFreeData();
+    is_ok &= _test_RcuHashTableThreads();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
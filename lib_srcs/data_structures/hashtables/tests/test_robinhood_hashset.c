@@ -0,0 +1,247 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "robinhood_hashset.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+
+/**
+ * @brief
+ *  Gets the i-th key, a small integer kept in the pointer itself.
+ */
+static void *_key(size_t i)
+{
+    return (void *)(uintptr_t)(i + 1);
+}
+
+/**
+ * @brief
+ *  Creates a set of the keys in the first half, or of every third key.
+ */
+static RobinHashSet_t *_createSet(bool is_thirds)
+{
+    RobinHashSet_t *set
+        = RobinHashSetCreate(16, 0.75, HT_INDEX_MASK, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (is_thirds ? i % 3 == 0 : i < KEY_COUNT / 2) {
+            RobinHashSetAdd(set, _key(i));
+        }
+    }
+    return set;
+}
+
+/**
+ * @brief
+ *  Checks that a set holds exactly the keys expected by is_in, printing the
+ *  ones that differ.
+ */
+static bool _checkSet(const RobinHashSet_t *set, bool (*is_in)(size_t),
+                      const char *op)
+{
+    bool is_ok = true;
+    size_t count = 0;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        bool res = RobinHashSetContains(set, _key(i));
+        count += is_in(i);
+        if (res != is_in(i)) {
+            is_ok = false;
+            printf("%s: %lu \t->\t res: %d | ans: %d\n", op, i, res, is_in(i));
+        }
+    }
+    if (set->count.used != count) {
+        is_ok = false;
+        printf("%s: count \t->\t res: %lu | ans: %lu\n", op, set->count.used,
+               count);
+    }
+    return is_ok;
+}
+
+static bool _isInUnion(size_t i)
+{
+    return i < KEY_COUNT / 2 || i % 3 == 0;
+}
+
+static bool _isInIntersect(size_t i)
+{
+    return i < KEY_COUNT / 2 && i % 3 == 0;
+}
+
+static bool _isInDifference(size_t i)
+{
+    return i < KEY_COUNT / 2 && i % 3 != 0;
+}
+
+static bool _isInNone(size_t i)
+{
+    (void)i;
+    return false;
+}
+
+static bool _test_RobinHashSetAddContainsRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    HTIndexing_t policies[] = {HT_INDEX_MOD, HT_INDEX_MASK, HT_INDEX_MULSHIFT};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(HTIndexing_t); p++) {
+        RobinHashSet_t *set
+            = RobinHashSetCreate(100, 0.8, policies[p], ptrHash, compPtr);
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            int res = RobinHashSetAdd(set, _key(i));
+            if (res != 1) {
+                is_ok = false;
+                printf("policy %lu: add: %lu \t->\t res: %d | ans: 1\n", p, i,
+                       res);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i += 2) {
+            int res = RobinHashSetAdd(set, _key(i));
+            if (res != 0) {
+                is_ok = false;
+                printf("policy %lu: re-add: %lu \t->\t res: %d | ans: 0\n", p,
+                       i, res);
+            }
+            if (!RobinHashSetRemove(set, _key(i), NULL)) {
+                is_ok = false;
+                printf("policy %lu: remove: %lu \t->\t failed\n", p, i);
+            }
+        }
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            bool res = RobinHashSetContains(set, _key(i));
+            if (res != (i % 2 == 1)) {
+                is_ok = false;
+                printf("policy %lu: contains: %lu \t->\t res: %d | ans: %d\n",
+                       p, i, res, i % 2 == 1);
+            }
+        }
+        if (RobinHashSetRemove(set, _key(0), NULL)) {
+            is_ok = false;
+            printf("policy %lu: remove missing: res: true | ans: false\n", p);
+        }
+        RobinHashSetClear(&set, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashSetMaxPsl()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashSet_t *set
+        = RobinHashSetCreate(100, 0.75, HT_INDEX_MOD, ptrHash, compPtr);
+    if (set->count.limit != 75) {
+        is_ok = false;
+        printf("limit: res: %lu | ans: 75\n", set->count.limit);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (i == 75) {
+            if (set->count.max != 100) {
+                is_ok = false;
+                printf("max: res: %lu | ans: 100\n", set->count.max);
+            }
+            // a short max_psl forces rehashes before the max load is reached
+            set->max_psl = 4;
+        }
+        if (RobinHashSetAdd(set, _key(i)) != 1) {
+            is_ok = false;
+            printf("add: %lu \t->\t failed\n", i);
+        }
+    }
+    for (size_t i = 0; i < set->count.max; i++) {
+        if (set->psls[i] > set->max_psl + 1) {
+            is_ok = false;
+            printf("psl: %lu \t->\t res: %d | ans: <= %d\n", i,
+                   set->psls[i] - 1, set->max_psl);
+        }
+    }
+    if (set->count.used != KEY_COUNT
+        || set->count.limit > set->count.max * 0.75 + 1) {
+        is_ok = false;
+        printf("count: res: %lu, limit %lu | ans: %d, limit <= 0.75 max\n",
+               set->count.used, set->count.limit, KEY_COUNT);
+    }
+    RobinHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashSetUnion()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashSet_t *set = _createSet(false);
+    RobinHashSet_t *other = _createSet(true);
+    if (!RobinHashSetUnion(set, other)) {
+        is_ok = false;
+        printf("union: failed\n");
+    }
+    is_ok &= _checkSet(set, _isInUnion, "union");
+    RobinHashSetUnion(set, set);
+    is_ok &= _checkSet(set, _isInUnion, "self union");
+    RobinHashSetClear(&other, NULL);
+    RobinHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashSetIntersect()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashSet_t *set = _createSet(false);
+    RobinHashSet_t *other = _createSet(true);
+    size_t removed = RobinHashSetIntersect(set, other, NULL);
+    size_t ans = KEY_COUNT / 2 - (KEY_COUNT / 2 + 2) / 3;
+    if (removed != ans) {
+        is_ok = false;
+        printf("intersect: removed \t->\t res: %lu | ans: %lu\n", removed,
+               ans);
+    }
+    is_ok &= _checkSet(set, _isInIntersect, "intersect");
+    RobinHashSetIntersect(set, set, NULL);
+    is_ok &= _checkSet(set, _isInIntersect, "self intersect");
+    RobinHashSetClear(&other, NULL);
+    RobinHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashSetDifference()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashSet_t *set = _createSet(false);
+    RobinHashSet_t *other = _createSet(true);
+    size_t removed = RobinHashSetDifference(set, other, NULL);
+    size_t ans = (KEY_COUNT / 2 + 2) / 3;
+    if (removed != ans) {
+        is_ok = false;
+        printf("difference: removed \t->\t res: %lu | ans: %lu\n", removed,
+               ans);
+    }
+    is_ok &= _checkSet(set, _isInDifference, "difference");
+    RobinHashSetDifference(set, set, NULL);
+    is_ok &= _checkSet(set, _isInNone, "self difference");
+    RobinHashSetClear(&other, NULL);
+    RobinHashSetClear(&set, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_RobinHashSetAddContainsRemove();
+    is_ok &= _test_RobinHashSetMaxPsl();
+    is_ok &= _test_RobinHashSetUnion();
+    is_ok &= _test_RobinHashSetIntersect();
+    is_ok &= _test_RobinHashSetDifference();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
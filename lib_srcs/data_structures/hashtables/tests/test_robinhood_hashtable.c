@@ -0,0 +1,627 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "robinhood_hashtable.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_COUNT 2000
+#define MAX_CHAR 16
+
+static char keys[KEY_COUNT][MAX_CHAR];
+static int values[KEY_COUNT];
+
+#define FLOOD_BLOCKS 8
+#define FLOOD_COUNT (1 << FLOOD_BLOCKS)
+
+static char flood_keys[FLOOD_COUNT][2 * FLOOD_BLOCKS + 1];
+
+/**
+ * @brief
+ *  Fills the flood keys with every string of FLOOD_BLOCKS blocks of "Ez" or
+ *  "FY", which all have the same djb2 hash.
+ */
+static void _fillFloodKeys()
+{
+    for (size_t i = 0; i < FLOOD_COUNT; i++) {
+        for (size_t b = 0; b < FLOOD_BLOCKS; b++) {
+            memcpy(&flood_keys[i][2 * b], (i >> b) & 1 ? "FY" : "Ez", 2);
+        }
+        flood_keys[i][2 * FLOOD_BLOCKS] = '\0';
+    }
+}
+
+static void _fillKeys()
+{
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(keys[i], MAX_CHAR, "key_%lu", i);
+        values[i] = i;
+    }
+}
+
+static bool _test_RobinHashTableAddFind()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table = RobinHashTableCreate(
+        8, 0.8, HT_INDEX_MOD, djb2Hash, compStr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (!RobinHashTableAdd(table, keys[i], &values[i])) {
+            is_ok = false;
+            printf("add: %s \t->\t failed\n", keys[i]);
+        }
+    }
+    if (table->count.used != KEY_COUNT) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", table->count.used, KEY_COUNT);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = RobinHashTableFind(table, keys[i]);
+        if (res != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %p\n", keys[i], res,
+                   &values[i]);
+        }
+    }
+    if (RobinHashTableFind(table, "missing") != NULL) {
+        is_ok = false;
+        printf("find: missing \t->\t res: not NULL | ans: NULL\n");
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table = RobinHashTableCreate(
+        8, 0.8, HT_INDEX_MOD, djb2Hash, compStr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        int *res = RobinHashTableRemove(table, keys[i], NULL);
+        if (res != &values[i]) {
+            is_ok = false;
+            printf("remove: %s \t->\t res: %p | ans: %p\n", keys[i], res,
+                   &values[i]);
+        }
+    }
+    if (table->count.used != KEY_COUNT / 2) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", table->count.used,
+               KEY_COUNT / 2);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = RobinHashTableFind(table, keys[i]);
+        int *ans = (i % 2 == 0) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %p\n", keys[i], res, ans);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableIndexing()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    HTIndexing_t policies[] = {HT_INDEX_MOD, HT_INDEX_MASK, HT_INDEX_MULSHIFT};
+    for (size_t p = 0; p < sizeof(policies) / sizeof(HTIndexing_t); p++) {
+        RobinHashTable_t *table
+            = RobinHashTableCreate(10, 0.8, policies[p], djb2Hash, compStr);
+        if (policies[p] == HT_INDEX_MASK && table->count.max != 16) {
+            is_ok = false;
+            printf("policy %lu: count.max res: %lu | ans: 16\n", p,
+                   table->count.max);
+        }
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            RobinHashTableAdd(table, keys[i], &values[i]);
+        }
+        for (size_t i = 0; i < KEY_COUNT; i += 3) {
+            RobinHashTableRemove(table, keys[i], NULL);
+        }
+        for (size_t i = 0; i < KEY_COUNT; i++) {
+            int *res = RobinHashTableFind(table, keys[i]);
+            int *ans = (i % 3 == 0) ? NULL : &values[i];
+            if (res != ans) {
+                is_ok = false;
+                printf("policy %lu: find: %s \t->\t res: %p | ans: %p\n", p,
+                       keys[i], res, ans);
+            }
+        }
+        RobinHashTableClear(&table, NULL, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableIncremental()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table = RobinHashTableCreate(
+        8, 0.8, HT_INDEX_MASK, djb2Hash, compStr);
+    table->rehash_step = 2;
+    bool migrated = false;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+        migrated |= table->old.buckets != NULL;
+        // every key added so far must stay reachable mid migration
+        for (size_t j = (i > 50) ? i - 50 : 0; j <= i; j++) {
+            if (j % 5 == 0 && j + 25 < i) {
+                continue;
+            }
+            if (RobinHashTableFind(table, keys[j]) != &values[j]) {
+                is_ok = false;
+                printf("find after %lu: %s \t->\t not found\n", i, keys[j]);
+            }
+        }
+        if (i >= 25 && (i - 25) % 5 == 0
+            && RobinHashTableRemove(table, keys[i - 25], NULL)
+                   != &values[i - 25]) {
+            is_ok = false;
+            printf("remove: %s \t->\t not found\n", keys[i - 25]);
+        }
+    }
+    if (!migrated) {
+        is_ok = false;
+        printf("migrated: res: false | ans: true\n");
+    }
+    for (size_t i = 0; i + 25 < KEY_COUNT; i++) {
+        int *res = RobinHashTableFind(table, keys[i]);
+        int *ans = (i % 5 == 0) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %p\n", keys[i], res, ans);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static size_t _constHash(const void *key)
+{
+    (void)key;
+    return 0;
+}
+
+static bool _test_RobinHashTableCollisions()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(512, 0.9, HT_INDEX_MOD, _constHash, compStr);
+    size_t added = 0;
+    for (size_t i = 0; i < 300; i++) {
+        if (RobinHashTableAdd(table, keys[i], &values[i])) {
+            added++;
+        }
+    }
+    if (added != ROBIN_HT_MAX_PSL + 1) {
+        is_ok = false;
+        printf("added: res: %lu | ans: %d\n", added, ROBIN_HT_MAX_PSL + 1);
+    }
+    for (size_t i = 0; i < added; i++) {
+        if (RobinHashTableFind(table, keys[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t not found\n", keys[i]);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableMaxPsl()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(100, 0.75, HT_INDEX_MOD, djb2Hash, compStr);
+    if (table->count.limit != 75) {
+        is_ok = false;
+        printf("limit: res: %lu | ans: 75\n", table->count.limit);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (i == 75) {
+            if (table->count.max != 100) {
+                is_ok = false;
+                printf("max: res: %lu | ans: 100\n", table->count.max);
+            }
+            // a short max_psl forces rehashes before the max load is reached
+            table->max_psl = 4;
+        }
+        if (!RobinHashTableAdd(table, keys[i], &values[i])) {
+            is_ok = false;
+            printf("add: %s \t->\t failed\n", keys[i]);
+        }
+    }
+    for (size_t i = 0; i < table->count.max; i++) {
+        if (table->psls[i] > table->max_psl + 1) {
+            is_ok = false;
+            printf("psl: %lu \t->\t res: %d | ans: <= %d\n", i,
+                   table->psls[i] - 1, table->max_psl);
+        }
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (RobinHashTableFind(table, keys[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t not found\n", keys[i]);
+        }
+    }
+    // bucket counts whose arrays would overflow are rejected, not wrapped
+    size_t max_count = table->count.max;
+    if (RobinHashTableRehash(table, SIZE_MAX / 2 + 2) != 0
+        || RobinHashTableReserve(table, SIZE_MAX)
+        || table->count.max != max_count) {
+        is_ok = false;
+        printf("overflow: res: resized | ans: rejected\n");
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+/**
+ * @brief
+ *  Hashes keys into the last 16 of 256 buckets, so a full enough table has a
+ *  cluster wrapping past the end.
+ */
+static size_t _tailHash(const void *key)
+{
+    return 240 + djb2Hash(key) % 16;
+}
+
+static bool _isMultiple(const void *key, const void *data, void *arg)
+{
+    (void)key;
+    return *(const int *)data % *(int *)arg == 0;
+}
+
+static bool _test_RobinHashTableRemoveIf()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *tables[2] = {
+        RobinHashTableCreate(8, 0.9, HT_INDEX_MASK, djb2Hash, compStr),
+        RobinHashTableCreate(256, 0, HT_INDEX_MOD, _tailHash, compStr),
+    };
+    size_t counts[2] = {KEY_COUNT, 200};
+    for (size_t t = 0; t < 2; t++) {
+        RobinHashTable_t *table = tables[t];
+        for (size_t i = 0; i < counts[t]; i++) {
+            RobinHashTableAdd(table, keys[i], &values[i]);
+        }
+        int divisor = 3;
+        size_t removed = RobinHashTableRemoveIf(table, _isMultiple, &divisor,
+                                                NULL, NULL);
+        size_t ans = (counts[t] + 2) / 3;
+        if (removed != ans || table->count.used != counts[t] - ans) {
+            is_ok = false;
+            printf("remove: res: %lu, %lu | ans: %lu, %lu\n", removed,
+                   table->count.used, ans, counts[t] - ans);
+        }
+        for (size_t i = 0; i < counts[t]; i++) {
+            int *res = RobinHashTableFind(table, keys[i]);
+            int *ans = (i % 3 == 0) ? NULL : &values[i];
+            if (res != ans) {
+                is_ok = false;
+                printf("find: %s \t->\t res: %p | ans: %p\n", keys[i],
+                       (void *)res, (void *)ans);
+            }
+        }
+        RobinHashTableClear(&table, NULL, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableReserve()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.75, HT_INDEX_MASK, djb2Hash, compStr);
+    if (!RobinHashTableReserve(table, KEY_COUNT)
+        || !RobinHashTableReserve(table, 8)) {
+        is_ok = false;
+        printf("reserve: res: failed | ans: reserved\n");
+    }
+    size_t bucket_count = table->count.max;
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    if (table->count.max != bucket_count || table->rehashes.count != 1) {
+        is_ok = false;
+        printf("rehash: res: %lu, %lu | ans: %lu, 1\n", table->count.max,
+               table->rehashes.count, bucket_count);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (RobinHashTableFind(table, keys[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t not found\n", keys[i]);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static void _countSeen(void *key, void *data, void *arg)
+{
+    (void)key;
+    ((int *)arg)[*(int *)data] += 1;
+}
+
+static bool _test_RobinHashTableIter()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.9, HT_INDEX_MASK, djb2Hash, compStr);
+    table->rehash_step = 2; // leave a migration in progress
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    if (table->old.buckets == NULL) {
+        is_ok = false;
+        printf("migration: res: done | ans: in progress\n");
+    }
+    static int seen[KEY_COUNT];
+    memset(seen, 0, sizeof(seen));
+    RobinHTIter_t iter;
+    RobinHashTableIterBegin(table, &iter);
+    while (RobinHashTableIterNext(table, &iter)) {
+        _countSeen(iter.key, iter.data, seen);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (seen[i] != 1) {
+            is_ok = false;
+            printf("iter: %s \t->\t res: %d | ans: 1\n", keys[i], seen[i]);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableScan()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    size_t steps[3] = {0, 2, 0};
+    HTIndexing_t policies[3] = {HT_INDEX_MASK, HT_INDEX_MASK, HT_INDEX_MOD};
+    for (size_t p = 0; p < 3; p++) {
+        RobinHashTable_t *table
+            = RobinHashTableCreate(8, 0.9, policies[p], djb2Hash, compStr);
+        table->rehash_step = steps[p];
+        for (size_t i = 0; i < KEY_COUNT / 2; i++) {
+            RobinHashTableAdd(table, keys[i], &values[i]);
+        }
+        static int seen[KEY_COUNT];
+        memset(seen, 0, sizeof(seen));
+        // only the masked tables are rehashed under the scan
+        size_t added = (policies[p] == HT_INDEX_MASK) ? KEY_COUNT / 2
+                                                       : KEY_COUNT;
+        size_t cursor = 0;
+        do {
+            cursor = RobinHashTableScan(table, cursor, 4, _countSeen, seen);
+            for (size_t i = 0; i < 8 && added < KEY_COUNT; i++, added++) {
+                RobinHashTableAdd(table, keys[added], &values[added]);
+            }
+        } while (cursor != 0);
+        for (size_t i = 0; i < KEY_COUNT / 2; i++) {
+            if (seen[i] < 1 || (policies[p] != HT_INDEX_MASK && seen[i] > 1)) {
+                is_ok = false;
+                printf("scan %lu: %s \t->\t res: %d | ans: >= 1\n", p,
+                       keys[i], seen[i]);
+            }
+        }
+        RobinHashTableClear(&table, NULL, NULL);
+    }
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableIncrementalCollisions()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.9, HT_INDEX_MASK, _constHash, compStr);
+    table->rehash_step = 1;
+    bool is_added[400] = {false};
+    size_t added = 0;
+    for (size_t i = 0; i < 400; i++) {
+        is_added[i] = RobinHashTableAdd(table, keys[i], &values[i]);
+        added += is_added[i];
+    }
+    // colliding keys can't make the table grow without bound
+    if (table->count.used != added || table->count.max > 16 * 400) {
+        is_ok = false;
+        printf("count: res: %lu used, %lu max | ans: %lu used, <= %d max\n",
+               table->count.used, table->count.max, added, 16 * 400);
+    }
+    for (size_t i = 0; i < 400; i++) {
+        int *res = RobinHashTableFind(table, keys[i]);
+        if (res != (is_added[i] ? &values[i] : NULL)) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %s\n", keys[i],
+                   (void *)res, is_added[i] ? "found" : "NULL");
+        }
+    }
+    static int seen[KEY_COUNT];
+    memset(seen, 0, sizeof(seen));
+    size_t cursor = 0;
+    size_t calls = 0;
+    do {
+        cursor = RobinHashTableScan(table, cursor, 4, _countSeen, seen);
+        calls++;
+    } while (cursor != 0 && calls <= table->count.max + table->old.max);
+    for (size_t i = 0; i < 400; i++) {
+        if (seen[i] != is_added[i]) {
+            is_ok = false;
+            printf("scan: %s \t->\t res: %d | ans: %d\n", keys[i], seen[i],
+                   is_added[i]);
+        }
+    }
+    for (size_t i = 0; i < 400; i++) {
+        if (is_added[i]) {
+            RobinHashTableRemove(table, keys[i], NULL);
+        }
+    }
+    if (table->count.used != 0) {
+        is_ok = false;
+        printf("remove: res: %lu used | ans: 0 used\n", table->count.used);
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableFindBatch()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.9, HT_INDEX_MASK, djb2Hash, compStr);
+    table->rehash_step = 2; // leave a migration in progress
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    void *batch_keys[KEY_COUNT + 1];
+    void *results[KEY_COUNT + 1];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        batch_keys[i] = keys[i];
+    }
+    batch_keys[KEY_COUNT] = "missing";
+    RobinHashTableFindBatch(table, batch_keys, KEY_COUNT + 1, results);
+    for (size_t i = 0; i <= KEY_COUNT; i++) {
+        int *ans = (i < KEY_COUNT && i % 2 == 0) ? &values[i] : NULL;
+        if (results[i] != ans) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %p | ans: %p\n",
+                   (char *)batch_keys[i], results[i], ans);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableSeeded()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table = RobinHashTableCreateSeeded(
+        8, 0.9, HT_INDEX_MASK, wyStrHashSeeded, compStr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (RobinHashTableFind(table, keys[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t not found\n", keys[i]);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+
+    // keys sharing a djb2 hash overflow the probe sequence of an unseeded
+    // table, but are spread out by a keyed one
+    table = RobinHashTableCreateSeeded(8, 0.9, HT_INDEX_MASK, sipStrHash,
+                                       compStr);
+    for (size_t i = 0; i < FLOOD_COUNT; i++) {
+        if (!RobinHashTableAdd(table, flood_keys[i], &values[i])) {
+            is_ok = false;
+            printf("add: %s \t->\t failed\n", flood_keys[i]);
+        }
+    }
+    for (size_t i = 0; i < FLOOD_COUNT; i++) {
+        if (RobinHashTableFind(table, flood_keys[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %s \t->\t not found\n", flood_keys[i]);
+        }
+    }
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHashTableStats()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.5, HT_INDEX_MASK, djb2Hash, compStr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableAdd(table, keys[i], &values[i]);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        RobinHashTableFind(table, keys[i]);
+    }
+    HTStats_t stats;
+    RobinHashTableStats(table, &stats);
+    size_t binned = 0;
+    for (size_t i = 0; i < HT_STATS_BINS; i++) {
+        binned += stats.histogram[i];
+    }
+    if (stats.entries != KEY_COUNT || binned != KEY_COUNT
+        || stats.buckets != table->count.max || stats.load > 0.5) {
+        is_ok = false;
+        printf("shape: res: %lu, %lu, %f | ans: %d, %d, <= 0.5\n",
+               stats.entries, binned, stats.load, KEY_COUNT, KEY_COUNT);
+    }
+    if (stats.mean_probe < 1 || stats.max_probe < stats.mean_probe
+        || stats.rehashes.count < 8 || stats.rehashes.secs < 0) {
+        is_ok = false;
+        printf("probes: res: %f, %lu, %lu | ans: >= 1, >= mean, >= 8\n",
+               stats.mean_probe, stats.max_probe, stats.rehashes.count);
+    }
+#ifdef HT_STATS
+    if (stats.counters.lookups != KEY_COUNT
+        || stats.counters.compares < KEY_COUNT
+        || stats.counters.probes < stats.counters.compares) {
+        is_ok = false;
+        printf("counters: res: %lu, %lu, %lu | ans: %d, >= %d, >= compares\n",
+               stats.counters.lookups, stats.counters.compares,
+               stats.counters.probes, KEY_COUNT, KEY_COUNT);
+    }
+#endif
+    RobinHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    _fillKeys();
+    _fillFloodKeys();
+    bool is_ok = true;
+    is_ok &= _test_RobinHashTableAddFind();
+    is_ok &= _test_RobinHashTableRemove();
+    is_ok &= _test_RobinHashTableIndexing();
+    is_ok &= _test_RobinHashTableIncremental();
+    is_ok &= _test_RobinHashTableCollisions();
+    is_ok &= _test_RobinHashTableMaxPsl();
+    is_ok &= _test_RobinHashTableRemoveIf();
+    is_ok &= _test_RobinHashTableReserve();
+    is_ok &= _test_RobinHashTableIter();
+    is_ok &= _test_RobinHashTableScan();
+    is_ok &= _test_RobinHashTableIncrementalCollisions();
+    is_ok &= _test_RobinHashTableFindBatch();
+    is_ok &= _test_RobinHashTableSeeded();
+    is_ok &= _test_RobinHashTableStats();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
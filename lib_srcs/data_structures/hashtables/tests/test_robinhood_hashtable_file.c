@@ -0,0 +1,153 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "robinhood_hashtable.h"
+#include "robinhood_hashtable_file.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_COUNT 2000
+#define MAX_CHAR 16
+#define FILE_NAME "test_robinhood_hashtable_file.bin"
+
+static char *_newStr(const char *prefix, size_t i)
+{
+    char *str = malloc(MAX_CHAR);
+    snprintf(str, MAX_CHAR, "%s_%lu", prefix, i);
+    return str;
+}
+
+static size_t _keySize(const void *key)
+{
+    return strlen(key);
+}
+
+static size_t _dataSize(const void *data)
+{
+    return strlen(data) + 1;
+}
+
+static size_t _emptySize(const void *key)
+{
+    (void)key;
+    return 0;
+}
+
+static bool _writeFile(size_t key_count, size_t (*key_size)(const void *))
+{
+    RobinHashTable_t *table
+        = RobinHashTableCreate(8, 0.9, HT_INDEX_MASK, djb2Hash, compStr);
+    for (size_t i = 0; i < key_count; i++) {
+        RobinHashTableAdd(table, _newStr("key", i), _newStr("value", i));
+    }
+    FILE *file_dest = fopen(FILE_NAME, "wb");
+    bool is_written
+        = file_dest != NULL
+          && RobinHashTableWriteBinary(table, key_size, _dataSize, file_dest);
+    if (file_dest != NULL && fclose(file_dest) != 0) {
+        is_written = false;
+    }
+    RobinHashTableClear(&table, free, free);
+    return is_written;
+}
+
+static bool _test_RobinHTFileFind()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    if (!_writeFile(KEY_COUNT, _keySize)) {
+        printf("write: res: failed | ans: written\n");
+        printf("END %s\n", __func__);
+        return false;
+    }
+    RobinHTFile_t *file = RobinHTFileOpen(FILE_NAME);
+    if (file == NULL || file->header->entry_count != KEY_COUNT) {
+        printf("open: res: failed | ans: %d entries\n", KEY_COUNT);
+        printf("END %s\n", __func__);
+        return false;
+    }
+    char key[MAX_CHAR];
+    char value[MAX_CHAR];
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(key, MAX_CHAR, "key_%lu", i);
+        snprintf(value, MAX_CHAR, "value_%lu", i);
+        size_t data_len = 0;
+        const char *res = RobinHTFileFind(file, key, strlen(key), &data_len);
+        if (res == NULL || data_len != strlen(value) + 1
+            || strcmp(res, value) != 0) {
+            is_ok = false;
+            printf("find: %s \t->\t res: %s | ans: %s\n", key,
+                   res == NULL ? "NULL" : res, value);
+        }
+    }
+    const char *missing[3] = {"key_", "key_2000", "key_1999 "};
+    for (size_t i = 0; i < 3; i++) {
+        if (RobinHTFileFind(file, missing[i], strlen(missing[i]), NULL)
+            != NULL) {
+            is_ok = false;
+            printf("find: %s \t->\t res: found | ans: NULL\n", missing[i]);
+        }
+    }
+    RobinHTFileClose(&file);
+    remove(FILE_NAME);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_RobinHTFileInvalid()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    if (RobinHTFileOpen(FILE_NAME) != NULL) {
+        is_ok = false;
+        printf("open missing: res: opened | ans: NULL\n");
+    }
+    // an empty table still makes a valid file
+    RobinHTFile_t *file = NULL;
+    if (!_writeFile(0, _keySize) || (file = RobinHTFileOpen(FILE_NAME)) == NULL
+        || RobinHTFileFind(file, "key_0", 5, NULL) != NULL) {
+        is_ok = false;
+        printf("empty: res: failed | ans: opened, not found\n");
+    }
+    if (file != NULL) {
+        RobinHTFileClose(&file);
+    }
+    // a file cut short must be rejected rather than read past its end
+    _writeFile(KEY_COUNT, _keySize);
+    FILE *file_src = fopen(FILE_NAME, "rb");
+    fseek(file_src, 0, SEEK_END);
+    long size = ftell(file_src);
+    rewind(file_src);
+    char *bytes = malloc(size);
+    size_t read_size = fread(bytes, 1, size, file_src);
+    fclose(file_src);
+    FILE *file_dest = fopen(FILE_NAME, "wb");
+    fwrite(bytes, 1, read_size - 1, file_dest);
+    fclose(file_dest);
+    free(bytes);
+    if (RobinHTFileOpen(FILE_NAME) != NULL) {
+        is_ok = false;
+        printf("truncated: res: opened | ans: NULL\n");
+    }
+    // keys written as the same bytes can't be spread by more slots
+    if (_writeFile(KEY_COUNT, _emptySize)) {
+        is_ok = false;
+        printf("same keys: res: written | ans: failed\n");
+    }
+    remove(FILE_NAME);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_RobinHTFileFind();
+    is_ok &= _test_RobinHTFileInvalid();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,95 @@
+#include "robinhood_hashtable_typed.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+
+defRobinHashTable(IntMap, int, long, robinHTHashInt, robinHTEqual)
+
+static bool _test_IntMapAddFindRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    IntMap_t *table = IntMapCreate(8, 0.9);
+    for (int i = 0; i < KEY_COUNT; i++) {
+        if (!IntMapAdd(table, i * 3, i * 10L)) {
+            is_ok = false;
+            printf("add: %d \t->\t failed\n", i * 3);
+        }
+    }
+    if (table->count.used != KEY_COUNT || table->count.max < KEY_COUNT) {
+        is_ok = false;
+        printf("count: res: %lu, %lu | ans: %d, >= %d\n", table->count.used,
+               table->count.max, KEY_COUNT, KEY_COUNT);
+    }
+    for (int i = 0; i < KEY_COUNT; i += 2) {
+        long res = 0;
+        if (!IntMapRemove(table, i * 3, &res) || res != i * 10L) {
+            is_ok = false;
+            printf("remove: %d \t->\t res: %ld | ans: %ld\n", i * 3, res,
+                   i * 10L);
+        }
+    }
+    if (IntMapRemove(table, 0, NULL)) {
+        is_ok = false;
+        printf("remove: 0 \t->\t res: found | ans: not found\n");
+    }
+    for (int i = 0; i < KEY_COUNT; i++) {
+        long *res = IntMapFind(table, i * 3);
+        if (i % 2 == 0 ? res != NULL : (res == NULL || *res != i * 10L)) {
+            is_ok = false;
+            printf("find: %d \t->\t res: %p | ans: %ld\n", i * 3, (void *)res,
+                   i % 2 == 0 ? 0 : i * 10L);
+        }
+    }
+    IntMapClear(&table);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_IntMapFull()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    IntMap_t *table = IntMapCreate(16, 0);
+    for (int i = 0; i < 16; i++) {
+        IntMapAdd(table, i, i);
+    }
+    if (IntMapAdd(table, 16, 16) || table->count.max != 16) {
+        is_ok = false;
+        printf("add: 16 \t->\t res: added | ans: full\n");
+    }
+    if (IntMapRehash(table, 8) != -1 || IntMapRehash(table, 64) != 1) {
+        is_ok = false;
+        printf("rehash: res: failed | ans: -1, 1\n");
+    }
+    // the add limit follows the new bucket count
+    if (!IntMapAdd(table, 16, 16) || table->count.limit != 64) {
+        is_ok = false;
+        printf("add: 16 \t->\t res: full, limit %lu | ans: added, 64\n",
+               table->count.limit);
+    }
+    for (int i = 0; i < 16; i++) {
+        long *res = IntMapFind(table, i);
+        if (res == NULL || *res != i) {
+            is_ok = false;
+            printf("find: %d \t->\t not found\n", i);
+        }
+    }
+    IntMapClear(&table);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_IntMapAddFindRemove();
+    is_ok &= _test_IntMapFull();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,130 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "sharded_hashtable.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+#define THREAD_COUNT 4
+
+static int values[KEY_COUNT];
+
+typedef struct Worker {
+    ShardHashTable_t *table;
+    size_t first; // first key of the worker, strided by THREAD_COUNT
+    bool is_ok;
+} Worker_t;
+
+static void *_work(void *arg)
+{
+    Worker_t *worker = arg;
+    worker->is_ok = true;
+    for (size_t i = worker->first; i < KEY_COUNT; i += THREAD_COUNT) {
+        worker->is_ok
+            &= ShardHashTableAdd(worker->table, &values[i], &values[i]);
+    }
+    for (size_t i = worker->first; i < KEY_COUNT; i += THREAD_COUNT) {
+        worker->is_ok &= ShardHashTableFind(worker->table, &values[i])
+                         == &values[i];
+    }
+    for (size_t i = worker->first; i < KEY_COUNT; i += 2 * THREAD_COUNT) {
+        worker->is_ok &= ShardHashTableRemove(worker->table, &values[i], NULL)
+                         == &values[i];
+    }
+    return NULL;
+}
+
+static bool _test_ShardHashTableAddFindRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ShardHashTable_t *table
+        = ShardHashTableCreate(5, 8, 0.9, HT_INDEX_MASK, ptrHash, compPtr);
+    if (table->shard_count != 8) {
+        is_ok = false;
+        printf("shards: res: %lu | ans: 8\n", table->shard_count);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (!ShardHashTableAdd(table, &values[i], &values[i])) {
+            is_ok = false;
+            printf("add: %lu \t->\t failed\n", i);
+        }
+    }
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        int *res = ShardHashTableRemove(table, &values[i], NULL);
+        if (res != &values[i]) {
+            is_ok = false;
+            printf("remove: %lu \t->\t res: %p | ans: %p\n", i, res,
+                   &values[i]);
+        }
+    }
+    size_t used = 0;
+    for (size_t i = 0; i < table->shard_count; i++) {
+        used += table->shards[i].table->count.used;
+        if (table->shards[i].table->count.used == 0) {
+            is_ok = false;
+            printf("shard %lu: res: empty | ans: not empty\n", i);
+        }
+    }
+    if (used != KEY_COUNT / 2) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", used, KEY_COUNT / 2);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = ShardHashTableFind(table, &values[i]);
+        int *ans = (i % 2 == 0) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, res, ans);
+        }
+    }
+    ShardHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ShardHashTableThreads()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ShardHashTable_t *table
+        = ShardHashTableCreate(16, 8, 0.9, HT_INDEX_MASK, ptrHash, compPtr);
+    pthread_t threads[THREAD_COUNT];
+    Worker_t workers[THREAD_COUNT];
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        workers[t] = (Worker_t){.table = table, .first = t};
+        pthread_create(&threads[t], NULL, _work, &workers[t]);
+    }
+    for (size_t t = 0; t < THREAD_COUNT; t++) {
+        pthread_join(threads[t], NULL);
+        if (!workers[t].is_ok) {
+            is_ok = false;
+            printf("thread %lu: res: failed | ans: ok\n", t);
+        }
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = ShardHashTableFind(table, &values[i]);
+        int *ans = (i % (2 * THREAD_COUNT) < THREAD_COUNT) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, res, ans);
+        }
+    }
+    ShardHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_ShardHashTableAddFindRemove();
+    is_ok &= _test_ShardHashTableThreads();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,151 @@
+#include "comp_funcs.h"
+#include "hash_funcs.h"
+#include "swiss_hashtable.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define KEY_COUNT 2000
+
+static int values[KEY_COUNT];
+
+static bool _test_SwissHashTableAddFind()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    SwissHashTable_t *table = SwissHashTableCreate(8, 0.875, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        if (!SwissHashTableAdd(table, &values[i], &values[i])) {
+            is_ok = false;
+            printf("add: %lu \t->\t failed\n", i);
+        }
+    }
+    if (table->count.used != KEY_COUNT) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", table->count.used, KEY_COUNT);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = SwissHashTableFind(table, &values[i]);
+        if (res != &values[i]) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, res, &values[i]);
+        }
+    }
+    if (SwissHashTableFind(table, "missing") != NULL) {
+        is_ok = false;
+        printf("find: missing \t->\t res: not NULL | ans: NULL\n");
+    }
+    SwissHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_SwissHashTableRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    SwissHashTable_t *table = SwissHashTableCreate(8, 0.875, ptrHash, compPtr);
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        SwissHashTableAdd(table, &values[i], &values[i]);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i += 2) {
+        int *res = SwissHashTableRemove(table, &values[i], NULL);
+        if (res != &values[i]) {
+            is_ok = false;
+            printf("remove: %lu \t->\t res: %p | ans: %p\n", i, res,
+                   &values[i]);
+        }
+    }
+    if (table->count.used != KEY_COUNT / 2) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", table->count.used,
+               KEY_COUNT / 2);
+    }
+    for (size_t i = 0; i < KEY_COUNT; i++) {
+        int *res = SwissHashTableFind(table, &values[i]);
+        int *ans = (i % 2 == 0) ? NULL : &values[i];
+        if (res != ans) {
+            is_ok = false;
+            printf("find: %lu \t->\t res: %p | ans: %p\n", i, res, ans);
+        }
+    }
+    SwissHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_SwissHashTableChurn()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    SwissHashTable_t *table = SwissHashTableCreate(64, 0.875, ptrHash, compPtr);
+    for (size_t round = 0; round < 20; round++) {
+        for (size_t i = 0; i < 40; i++) {
+            SwissHashTableAdd(table, &values[round * 40 + i],
+                              &values[round * 40 + i]);
+        }
+        for (size_t i = 0; i < 40; i++) {
+            SwissHashTableRemove(table, &values[round * 40 + i], NULL);
+        }
+    }
+    if (table->count.used != 0 || table->count.max > 128) {
+        is_ok = false;
+        printf("count: res: %lu, %lu | ans: 0, <= 128\n", table->count.used,
+               table->count.max);
+    }
+    SwissHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_SwissHashTableFixedReuse()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    SwissHashTable_t *table = SwissHashTableCreate(32, 0, ptrHash, compPtr);
+    for (size_t i = 0; i < 32; i++) {
+        is_ok &= SwissHashTableAdd(table, &values[i], &values[i]);
+    }
+    if (SwissHashTableAdd(table, &values[32], &values[32])) {
+        is_ok = false;
+        printf("full add: res: added | ans: failed\n");
+    }
+    // slots freed by removes are reused, deleted or not
+    for (size_t round = 0; round < 100; round++) {
+        size_t old_i = round;
+        size_t new_i = 32 + round;
+        SwissHashTableRemove(table, &values[old_i], NULL);
+        if (!SwissHashTableAdd(table, &values[new_i], &values[new_i])) {
+            is_ok = false;
+            printf("add: %lu \t->\t failed\n", new_i);
+        }
+    }
+    for (size_t i = 100; i < 132; i++) {
+        if (SwissHashTableFind(table, &values[i]) != &values[i]) {
+            is_ok = false;
+            printf("find: %lu \t->\t not found\n", i);
+        }
+    }
+    if (table->count.used != 32 || table->count.max != 32) {
+        is_ok = false;
+        printf("count: res: %lu, %lu | ans: 32, 32\n", table->count.used,
+               table->count.max);
+    }
+    SwissHashTableClear(&table, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    bool is_ok = true;
+    is_ok &= _test_SwissHashTableAddFind();
+    is_ok &= _test_SwissHashTableRemove();
+    is_ok &= _test_SwissHashTableChurn();
+    is_ok &= _test_SwissHashTableFixedReuse();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
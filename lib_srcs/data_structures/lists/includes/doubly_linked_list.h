@@ -11,6 +11,7 @@
 #ifndef DOUBLY_LINKED_LIST_H
 #define DOUBLY_LINKED_LIST_H
 
+#include "node_pool.h"
 #include <stddef.h>
 
 typedef struct DLListNode {          // node in a doubly linked list
@@ -23,6 +24,7 @@ typedef struct DLList {
     struct DLListNode *head; // head node
     struct DLListNode *tail; // tail node
     size_t count;
+    NodePool_t *pool; // pool the nodes are allocated from; NULL for malloc
 } DLList_t;
 
 /**
@@ -34,6 +36,19 @@ typedef struct DLList {
  */
 extern DLList_t *DLListCreate();
 
+/**
+ * @brief
+ *  Makes a new empty doubly linked list whose nodes are allocated from a
+ *  node pool.
+ *
+ * @param[in,out] pool  node pool to share with other lists; NULL for a pool
+ *                      of the list's own, released whole when it's deleted
+ *
+ * @return Pointer to new doubly linked list, NULL if memory allocation is
+ * unsuccessful.
+ */
+extern DLList_t *DLListCreatePooled(NodePool_t *pool);
+
 /**
  * @brief
  *  Deletes a doubly linked list and it's data if a function for freeing it is
@@ -11,6 +11,7 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include "node_pool.h"
 #include <stdbool.h>
 #include <stddef.h>
 
@@ -23,6 +24,7 @@ typedef struct LList {
     LListNode_t *head; // head node
     LListNode_t *tail; // tail node
     int count;
+    NodePool_t *pool; // pool the nodes are allocated from; NULL for malloc
 } LList_t;
 
 /**
@@ -34,6 +36,18 @@ typedef struct LList {
  */
 extern LList_t *LListCreate();
 
+/**
+ * @brief
+ *  Makes a new empty linked list whose nodes are allocated from a node pool.
+ *
+ * @param[in,out] pool  node pool to share with other lists; NULL for a pool
+ *                      of the list's own, released whole when it's deleted
+ *
+ * @return Pointer to new linked list, NULL if memory allocation is
+ * unsuccessful.
+ */
+extern LList_t *LListCreatePooled(NodePool_t *pool);
+
 /**
  * @brief
  *  Deletes a linked list and it's data if a function for freeing it is given.
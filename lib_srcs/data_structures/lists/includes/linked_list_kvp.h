@@ -11,6 +11,7 @@
 #ifndef LINKED_LIST_KVP_H
 #define LINKED_LIST_KVP_H
 
+#include "node_pool.h"
 #include <stdbool.h>
 #include <stddef.h>
 
@@ -24,6 +25,7 @@ typedef struct LListKVP {
     LListKVPNode_t *head; // head node
     LListKVPNode_t *tail; // tail node
     size_t count;
+    NodePool_t *pool; // pool the nodes are allocated from; NULL for malloc
     /**
      *  The compare function must operate as follows: @n
      *  1) Returns int < 0 if key_1 should come before key_2 @n
@@ -49,6 +51,23 @@ typedef struct LListKVP {
 extern LListKVP_t *LListKVPCreate(int (*comp_key)(const void *,
                                                        const void *));
 
+/**
+ * @brief
+ *  Makes a new empty key-value pair linked list whose nodes are allocated
+ *  from a node pool.
+ *
+ * @param[in]     comp_key  function to compare the keys
+ * @param[in,out] pool      node pool to share with other lists; NULL for a
+ *                          pool of the list's own, released whole when it's
+ *                          deleted
+ *
+ * @return Pointer to new key-value pair linked list, NULL if memory allocation
+ * is unsuccessful.
+ */
+extern LListKVP_t *
+LListKVPCreatePooled(int (*comp_key)(const void *, const void *),
+                     NodePool_t *pool);
+
 /**
  * @brief
  *  Deletes a key-value pair linked list and it's data if a function for
@@ -142,6 +161,18 @@ extern bool LListKVPAddTail(LListKVP_t *list, void *key, void *data);
  */
 extern bool LListKVPAdd(LListKVP_t *list, void *key, void *data);
 
+/**
+ * @brief
+ *  Links an existing node into a key-value pair linked list at the position
+ *  determined by the compare funtion, without allocating. Nodes that arrive
+ *  in order are appended to the tail without searching.
+ *
+ * @param[in,out] list  key-value pair linked list to add to
+ * @param[in,out] node  node to link, not part of any list; allocated from
+ *                      the list's node pool, or with malloc if it has none
+ */
+extern void LListKVPAddNode(LListKVP_t *list, LListKVPNode_t *node);
+
 /**
  * @brief
  *  Gets the data of first instance of a matching key in a key-value pair
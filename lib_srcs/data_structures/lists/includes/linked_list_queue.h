@@ -11,6 +11,7 @@
 #ifndef LINKED_LIST_QUEUE_H
 #define LINKED_LIST_QUEUE_H
 
+#include "node_pool.h"
 #include <stdbool.h>
 
 typedef struct LListQueueNode {          // linked list queue node
@@ -21,6 +22,7 @@ typedef struct LListQueueNode {          // linked list queue node
 typedef struct LListQueue {              // linked list queue
     LListQueueNode_t *head; // head node
     LListQueueNode_t *tail; // tail node
+    NodePool_t *pool; // pool the nodes are allocated from; NULL for malloc
 } LListQueue_t;
 
 /**
@@ -31,6 +33,17 @@ typedef struct LListQueue {              // linked list queue
  */
 extern LListQueue_t *LListQueueCreate();
 
+/**
+ * @brief
+ *  Creates a new linked list queue whose nodes are allocated from a node pool
+ *
+ * @param[in,out] pool  node pool to share with other lists; NULL for a pool
+ *                      of the queue's own, released whole when it's deleted
+ *
+ * @return Pointer to the linked list queue. NULL if memory allocation failed.
+ */
+extern LListQueue_t *LListQueueCreatePooled(NodePool_t *pool);
+
 /**
  * @brief
  *  Enqueues new data to a linked list queue
@@ -11,6 +11,7 @@
 #ifndef LINKED_LIST_STACK_H
 #define LINKED_LIST_STACK_H
 
+#include "node_pool.h"
 #include <stdbool.h>
 
 typedef struct LListStackNode {          // linked list stack node
@@ -21,6 +22,7 @@ typedef struct LListStackNode {          // linked list stack node
 typedef struct LListStack {              // linked list stack
     LListStackNode_t *head; // head node
     LListStackNode_t *tail; // tail node
+    NodePool_t *pool; // pool the nodes are allocated from; NULL for malloc
 } LListStack_t;
 
 /**
@@ -31,6 +33,17 @@ typedef struct LListStack {              // linked list stack
  */
 extern LListStack_t *LListStackCreate();
 
+/**
+ * @brief
+ *  Creates a new linked list stack whose nodes are allocated from a node pool
+ *
+ * @param[in,out] pool  node pool to share with other lists; NULL for a pool
+ *                      of the stack's own, released whole when it's deleted
+ *
+ * @return Pointer to the linked list stack. NULL if memory allocation failed.
+ */
+extern LListStack_t *LListStackCreatePooled(NodePool_t *pool);
+
 /**
  * @brief
  *  Pushes new data to a linked list stack
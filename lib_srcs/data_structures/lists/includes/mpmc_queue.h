@@ -0,0 +1,148 @@
+/**
+ * @file mpmc_queue.h
+ *
+ * @brief
+ *  Structs and functions for bounded multi-producer multi-consumer queues,
+ *  ring buffers that any number of threads can enqueue to and dequeue from
+ *  without locks. Each cell carries a sequence number telling which lap of
+ *  the ring it's ready for, so a thread claims a position with a single
+ *  compare-and-swap on the head or tail and then only touches its cell.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MPMC_QUEUE_ALIGN 64 // head and tail are on cache lines of their own
+                            // so producers and consumers don't share one
+
+typedef struct MpmcQueueCell { // cell of a multi-producer multi-consumer queue
+    _Atomic size_t seq;        // position the cell is ready for: the enqueue
+                               // position if empty, that plus 1 if full
+    void *data;                // Pointer to data
+} MpmcQueueCell_t;
+
+typedef struct MpmcQueue {                       // multi-producer
+    _Alignas(MPMC_QUEUE_ALIGN) _Atomic size_t tail; // multi-consumer queue;
+                                                 // next position to enqueue
+    _Alignas(MPMC_QUEUE_ALIGN) _Atomic size_t head; // next position to dequeue
+    _Alignas(MPMC_QUEUE_ALIGN) MpmcQueueCell_t *cells; // Dynamic array of
+                                                       // cells
+    size_t mask; // number of cells - 1
+} MpmcQueue_t;
+
+/**
+ * @brief
+ *  Creates a new multi-producer multi-consumer queue.
+ *
+ * @param[in] capacity  max number of data; rounded up to a power of 2
+ *
+ * @return Pointer to the queue. NULL if memory allocation failed.
+ */
+extern MpmcQueue_t *MpmcQueueCreate(size_t capacity);
+
+/**
+ * @brief
+ *  Deletes a multi-producer multi-consumer queue and frees its data if given
+ *  a function to do so. No other thread may use the queue at the same time.
+ *
+ * @param[in,out] p_queue       queue to delete
+ * @param[in]     free_data     function to free data, NULL if not needed
+ */
+extern void MpmcQueueClear(MpmcQueue_t **p_queue, void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Enqueues new data to a multi-producer multi-consumer queue if it's not
+ *  full.
+ *
+ * @param[in,out] queue     queue to enqueue to
+ * @param[in]     data      new data
+ *
+ * @return
+ *   true  : enqueued successfully @n
+ *   false : queue is full @n
+ */
+extern bool MpmcQueueTryEnqueue(MpmcQueue_t *queue, void *data);
+
+/**
+ * @brief
+ *  Enqueues new data to a multi-producer multi-consumer queue, yielding the
+ *  thread until there's space if it's full.
+ *
+ * @param[in,out] queue     queue to enqueue to
+ * @param[in]     data      new data
+ */
+extern void MpmcQueueEnqueue(MpmcQueue_t *queue, void *data);
+
+/**
+ * @brief
+ *  Enqueues as many of the given data as there's consecutive space for,
+ *  claiming all their positions with one compare-and-swap.
+ *
+ * @param[in,out] queue     queue to enqueue to
+ * @param[in]     data_arr  array of new data
+ * @param[in]     count     number of data in the array
+ *
+ * @return Number of data enqueued from the start of the array, 0 if the
+ * queue is full.
+ */
+extern size_t MpmcQueueTryEnqueueMany(MpmcQueue_t *queue, void **data_arr,
+                                      size_t count);
+
+/**
+ * @brief
+ *  Dequeues data from a multi-producer multi-consumer queue if it's not
+ *  empty.
+ *
+ * @note
+ *  Enqueued NULL pointers can't be told apart from an empty queue.
+ *
+ * @param[in,out] queue     queue to dequeue
+ *
+ * @return Pointer to the dequeued data, NULL if the queue is empty.
+ */
+extern void *MpmcQueueTryDequeue(MpmcQueue_t *queue);
+
+/**
+ * @brief
+ *  Dequeues data from a multi-producer multi-consumer queue, yielding the
+ *  thread until there's data if it's empty.
+ *
+ * @param[in,out] queue     queue to dequeue
+ *
+ * @return Pointer to the dequeued data.
+ */
+extern void *MpmcQueueDequeue(MpmcQueue_t *queue);
+
+/**
+ * @brief
+ *  Dequeues up to the given number of consecutive data, claiming all their
+ *  positions with one compare-and-swap.
+ *
+ * @param[in,out] queue     queue to dequeue
+ * @param[out]    data_arr  array to store the dequeued data
+ * @param[in]     count     array length
+ *
+ * @return Number of data dequeued, 0 if the queue is empty.
+ */
+extern size_t MpmcQueueTryDequeueMany(MpmcQueue_t *queue, void **data_arr,
+                                      size_t count);
+
+/**
+ * @brief
+ *  Gets the number of data in a multi-producer multi-consumer queue. Only a
+ *  snapshot while other threads are using it.
+ *
+ * @param[in] queue     queue to count
+ *
+ * @return Number of data in the queue.
+ */
+extern size_t MpmcQueueCount(MpmcQueue_t *queue);
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file node_pool.h
+ *
+ * @brief
+ *  Structs and functions for node pools, fixed size allocators that carve
+ *  list nodes out of slabs and recycle freed nodes through a free list, so
+ *  adding and removing nodes rarely reaches malloc. A pool can back a single
+ *  list or be shared by several lists with nodes of the same size, but not
+ *  between threads.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NODE_POOL_SLAB_NODES 64 // nodes per slab of a pool made by a list
+
+typedef struct NodePoolSlab {          // slab of nodes, followed by the nodes
+    _Alignas(max_align_t) struct NodePoolSlab *next; // next slab allocated
+} NodePoolSlab_t;
+
+typedef struct NodePool {
+    void *free_list;       // first freed node, each linking to the next
+                           // through its first bytes
+    NodePoolSlab_t *slabs; // slabs allocated, newest first
+    char *bump;            // next never used node of the newest slab
+    char *bump_end;        // end of the newest slab
+    size_t node_size;      // size of each node
+    size_t slab_nodes;     // nodes per slab
+    size_t used;           // nodes allocated and not freed
+    size_t refs;           // lists and other owners sharing the pool
+} NodePool_t;
+
+/**
+ * @brief
+ *  Creates an empty node pool, with one reference held by the caller.
+ *
+ * @param[in] node_size     size of the nodes; rounded up to hold a pointer
+ * @param[in] slab_nodes    nodes allocated at once when the pool runs out
+ *
+ * @return New node pool. NULL if unable to allocate memory.
+ */
+extern NodePool_t *NodePoolCreate(size_t node_size, size_t slab_nodes);
+
+/**
+ * @brief
+ *  Drops a reference to a node pool, and frees every slab of it at once if
+ *  it was the last one.
+ *
+ * @param[in,out] p_pool    node pool to drop
+ */
+extern void NodePoolClear(NodePool_t **p_pool);
+
+/**
+ * @brief
+ *  Takes another reference to a node pool, for a list sharing it.
+ *
+ * @param[in,out] pool      node pool to share
+ *
+ * @return The node pool.
+ */
+extern NodePool_t *NodePoolShare(NodePool_t *pool);
+
+/**
+ * @brief
+ *  Gets the node pool of a new list: shares the given pool, or creates one
+ *  of its own with NODE_POOL_SLAB_NODES nodes per slab if none is given.
+ *
+ * @param[in,out] pool      node pool to share; NULL for a new one
+ * @param[in]     node_size size of the list's nodes
+ *
+ * @return Node pool for the list. NULL if unable to allocate memory.
+ */
+extern NodePool_t *NodePoolAcquire(NodePool_t *pool, size_t node_size);
+
+/**
+ * @brief
+ *  Allocates a zeroed node from a node pool, reusing a freed node if there
+ *  is one, or with calloc if no pool is given.
+ *
+ * @param[in,out] pool      node pool to allocate from; NULL for calloc
+ * @param[in]     node_size size of the node; at most the pool's node size
+ *
+ * @return Pointer to the node, NULL if unable to allocate memory.
+ */
+extern void *NodePoolAlloc(NodePool_t *pool, size_t node_size);
+
+/**
+ * @brief
+ *  Returns a node to the node pool it was allocated from, or frees it if no
+ *  pool is given.
+ *
+ * @param[in,out] pool      node pool the node came from; NULL for free
+ * @param[in]     node      node to return
+ */
+extern void NodePoolFree(NodePool_t *pool, void *node);
+
+/**
+ * @brief
+ *  Checks whether a list clearing its nodes is the only holder of its node
+ *  pool, in which case the pool's slabs are freed whole when the list drops
+ *  it and the nodes needn't be returned one by one.
+ *
+ * @param[in] pool      node pool of the list; NULL if it has none
+ *
+ * @return true  : the pool is held by the list alone @n
+ *         false : the pool is shared, or there is no pool @n
+ */
+extern bool NodePoolIsSole(const NodePool_t *pool);
+
+/**
+ * @brief
+ *  Returns a node of a list being cleared: does nothing if the list is the
+ *  only holder of the pool, as its slabs are about to be freed whole, and is
+ *  NodePoolFree otherwise.
+ *
+ * @param[in,out] pool      node pool the node came from; NULL for free
+ * @param[in]     node      node to return
+ */
+extern void NodePoolRelease(NodePool_t *pool, void *node);
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @file spsc_queue.h
+ *
+ * @brief
+ *  Structs and functions for bounded single-producer single-consumer queues,
+ *  wait-free ring buffers handing data from exactly one thread to exactly
+ *  one other. Each side keeps a cached copy of the other side's index next
+ *  to its own and only reloads it when the cache says the ring is full or
+ *  empty, so the two threads rarely touch each other's cache lines.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SPSC_QUEUE_ALIGN 64 // each side's indices are on a cache line of
+                            // their own
+
+typedef struct SpscQueue { // single-producer single-consumer queue
+    _Alignas(SPSC_QUEUE_ALIGN) _Atomic size_t tail; // next position to
+                                                    // enqueue
+    size_t head_cache; // head last seen by the producer
+    _Alignas(SPSC_QUEUE_ALIGN) _Atomic size_t head; // next position to
+                                                    // dequeue
+    size_t tail_cache; // tail last seen by the consumer
+    _Alignas(SPSC_QUEUE_ALIGN) void **data; // Dynamic array of pointers to
+                                            // data
+    size_t mask; // capacity - 1
+} SpscQueue_t;
+
+/**
+ * @brief
+ *  Creates a new single-producer single-consumer queue.
+ *
+ * @param[in] capacity  max number of data; rounded up to a power of 2
+ *
+ * @return Pointer to the queue. NULL if memory allocation failed.
+ */
+extern SpscQueue_t *SpscQueueCreate(size_t capacity);
+
+/**
+ * @brief
+ *  Deletes a single-producer single-consumer queue and frees its data if
+ *  given a function to do so. Neither side may use the queue at the same
+ *  time.
+ *
+ * @param[in,out] p_queue       queue to delete
+ * @param[in]     free_data     function to free data, NULL if not needed
+ */
+extern void SpscQueueClear(SpscQueue_t **p_queue, void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Enqueues new data to a single-producer single-consumer queue. Only called
+ *  by the producer.
+ *
+ * @param[in,out] queue     queue to enqueue to
+ * @param[in]     data      new data
+ *
+ * @return
+ *   true  : enqueued successfully @n
+ *   false : queue is full @n
+ */
+extern bool SpscQueueEnqueue(SpscQueue_t *queue, void *data);
+
+/**
+ * @brief
+ *  Enqueues as many of the given data as there's space for, publishing them
+ *  all to the consumer with one release store. Only called by the producer.
+ *
+ * @param[in,out] queue     queue to enqueue to
+ * @param[in]     data_arr  array of new data
+ * @param[in]     count     number of data in the array
+ *
+ * @return Number of data enqueued from the start of the array, 0 if the
+ * queue is full.
+ */
+extern size_t SpscQueueEnqueueMany(SpscQueue_t *queue, void **data_arr,
+                                   size_t count);
+
+/**
+ * @brief
+ *  Dequeues data from a single-producer single-consumer queue. Only called
+ *  by the consumer.
+ *
+ * @note
+ *  Enqueued NULL pointers can't be told apart from an empty queue.
+ *
+ * @param[in,out] queue     queue to dequeue
+ *
+ * @return Pointer to the dequeued data, NULL if the queue is empty.
+ */
+extern void *SpscQueueDequeue(SpscQueue_t *queue);
+
+/**
+ * @brief
+ *  Dequeues up to the given number of data, handing all their cells back to
+ *  the producer with one release store. Only called by the consumer.
+ *
+ * @param[in,out] queue     queue to dequeue
+ * @param[out]    data_arr  array to store the dequeued data
+ * @param[in]     count     array length
+ *
+ * @return Number of data dequeued, 0 if the queue is empty.
+ */
+extern size_t SpscQueueDequeueMany(SpscQueue_t *queue, void **data_arr,
+                                   size_t count);
+
+/**
+ * @brief
+ *  Gets the number of data in a single-producer single-consumer queue. Only
+ *  a snapshot while the other side is using it.
+ *
+ * @param[in] queue     queue to count
+ *
+ * @return Number of data in the queue.
+ */
+extern size_t SpscQueueCount(SpscQueue_t *queue);
+#endif
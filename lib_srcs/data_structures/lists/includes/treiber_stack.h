@@ -0,0 +1,99 @@
+/**
+ * @file treiber_stack.h
+ *
+ * @brief
+ *  Structs and functions for bounded lock-free Treiber stacks, for stacks
+ *  shared between threads. Nodes come from an array allocated with the
+ *  stack and are recycled through a free list, itself a Treiber stack, so
+ *  pushes never allocate and a node is never freed while a thread may still
+ *  read it. Both heads pack the index of the top node with a tag bumped by
+ *  every change, so a compare-and-swap fails if the top was popped and
+ *  pushed back in between (ABA). A push and a pop that lose a race on the
+ *  head may instead meet in an elimination slot and hand the data over
+ *  without touching the head.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef TREIBER_STACK_H
+#define TREIBER_STACK_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TREIBER_STACK_ALIGN 64     // heads and elimination slots are on cache
+                                   // lines of their own
+#define TREIBER_STACK_ELIM_SLOTS 4 // number of elimination slots
+#define TREIBER_STACK_ELIM_SPINS 64 // times a push checks its slot for a pop
+                                    // before withdrawing
+
+typedef struct TreiberStackNode { // Treiber stack node
+    void *data;                   // Pointer to data
+    _Atomic uint32_t next;        // index of the next node in the stack
+} TreiberStackNode_t;
+
+typedef struct TreiberStackSlot { // elimination slot
+    _Alignas(TREIBER_STACK_ALIGN) _Atomic uint64_t offer; // 0 if empty, index
+                                        // of a pushed node + 1, or taken
+} TreiberStackSlot_t;
+
+typedef struct TreiberStack {                             // Treiber stack
+    _Alignas(TREIBER_STACK_ALIGN) _Atomic uint64_t head;  // tag << 32 | index
+                                                          // of the top node
+    _Alignas(TREIBER_STACK_ALIGN) _Atomic uint64_t free_head; // same for the
+                                                              // free nodes
+    TreiberStackSlot_t slots[TREIBER_STACK_ELIM_SLOTS];
+    TreiberStackNode_t *nodes; // Dynamic array of nodes
+    size_t capacity;           // number of nodes
+} TreiberStack_t;
+
+/**
+ * @brief
+ *  Creates a new Treiber stack
+ *
+ * @param[in] capacity  max number of data; less than UINT32_MAX
+ *
+ * @return Pointer to the Treiber stack. NULL if memory allocation failed.
+ */
+extern TreiberStack_t *TreiberStackCreate(size_t capacity);
+
+/**
+ * @brief
+ *  Pushes new data to a Treiber stack
+ *
+ * @param[in,out] stack     Treiber stack to push to
+ * @param[in]     data      new data
+ *
+ * @return
+ *   true  : pushed successfully @n
+ *   false : stack is full @n
+ */
+extern bool TreiberStackPush(TreiberStack_t *stack, void *data);
+
+/**
+ * @brief
+ *  Pops data from a Treiber stack
+ *
+ * @note
+ *  Pushed NULL pointers can't be told apart from an empty stack.
+ *
+ * @param[in,out] stack     Treiber stack to pop
+ *
+ * @return Pointer to the popped data, NULL if the stack is empty.
+ */
+extern void *TreiberStackPop(TreiberStack_t *stack);
+
+/**
+ * @brief
+ *  Deletes a Treiber stack and frees its data if given a function to do so.
+ *  No other thread may use the stack at the same time.
+ *
+ * @param[in,out] p_stack       Treiber stack to delete
+ * @param[in]     free_data     function to free data, NULL if not needed
+ */
+extern void TreiberStackClear(TreiberStack_t **p_stack,
+                              void (*free_data)(void *));
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file unrolled_linked_list.h
+ *
+ * @brief
+ *  Structs and functions for unrolled linked lists. Each node holds up to
+ *  ULLIST_NODE_CAP data pointers in an array, so a scan follows one pointer
+ *  per block of elements instead of per element, and index lookups skip
+ *  whole blocks by their counts.
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ULLIST_NODE_CAP 14 // data pointers per node; a node takes 2 cache
+                           // lines on 64 bit machines
+
+typedef struct ULListNode {          // node in an unrolled linked list
+    struct ULListNode *next;         // next node in unrolled linked list
+    size_t count;                    // number of data in the node
+    void *data[ULLIST_NODE_CAP];     // pointers to data, packed from 0
+} ULListNode_t;
+
+typedef struct ULList {
+    ULListNode_t *head; // head node
+    ULListNode_t *tail; // tail node
+    size_t count;       // number of data in the list
+} ULList_t;
+
+/**
+ * @brief
+ *  Makes a new empty unrolled linked list.
+ *
+ * @return Pointer to new unrolled linked list, NULL if memory allocation is
+ * unsuccessful.
+ */
+extern ULList_t *ULListCreate();
+
+/**
+ * @brief
+ *  Deletes an unrolled linked list and it's data if a function for freeing
+ *  it is given.
+ *
+ * @param[in,out] p_list        unrolled linked list to delete
+ * @param[in]     free_data     function to free data, NULL if not needed
+ */
+extern void ULListClear(ULList_t **p_list, void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Deletes the first data in an unrolled linked list and frees it if a
+ *  function for freeing it is given.
+ *
+ * @param[in,out] list          unrolled linked list to remove from
+ * @param[in]     free_data     function to free data, NULL if not needed
+ *
+ * @return true  : removal successful
+ * @return false : unrolled linked list is empty
+ */
+extern bool ULListRemoveHead(ULList_t *list, void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Deletes the data at the given index of an unrolled linked list and frees
+ *  it if a function for freeing it is given. A node left less than half full
+ *  is merged with the next one if they fit in one.
+ *
+ * @param[in,out] list          unrolled linked list to remove from
+ * @param[in]     idx           index of the data to delete
+ * @param[in]     free_data     function to free data, NULL if not needed
+ *
+ * @return true  : removal successful
+ * @return false : invalid index
+ */
+extern bool ULListRemoveAt(ULList_t *list, size_t idx,
+                           void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Deletes all data of an unrolled linked list (but not the list itself) and
+ *  frees it if a function for freeing it is given.
+ *
+ * @param[in,out] list          unrolled linked list to remove from
+ * @param[in]     free_data     function to free data, NULL if not needed
+ */
+extern void ULListRemoveAll(ULList_t *list, void (*free_data)(void *));
+
+/**
+ * @brief
+ *  Adds data to the start of an unrolled linked list.
+ *
+ * @param[in,out] list  unrolled linked list add to
+ * @param[in]     data  new data
+ *
+ * @return true  : data added successfully
+ * @return false : memory allocation falied
+ */
+extern bool ULListAddHead(ULList_t *list, void *data);
+
+/**
+ * @brief
+ *  Adds data to the end of an unrolled linked list.
+ *
+ * @param[in,out] list  unrolled linked list add to
+ * @param[in]     data  new data
+ *
+ * @return true  : data added successfully
+ * @return false : memory allocation falied
+ */
+extern bool ULListAddTail(ULList_t *list, void *data);
+
+/**
+ * @brief
+ *  Adds data at the given index of an unrolled linked list, splitting the
+ *  node it falls in if that's full.
+ *
+ * @param[in,out] list  unrolled linked list to add to
+ * @param[in]     data  new data
+ * @param[in]     idx   index of the new data
+ *
+ * @return
+ *   1 : data added successfully @n
+ *   0 : memory allocation falied @n
+ *  -1 : invalid index @n
+ */
+extern int ULListAddAt(ULList_t *list, void *data, size_t idx);
+
+/**
+ * @brief
+ *  Adds data to an unrolled linked list at the position determined by the
+ *  compare funtion.
+ *
+ * @note
+ *  The compare function must operate as follows: @n
+ *  1) Returns int < 0 if data_1 should come before data_2 @n
+ *  2) Returns int >= 0 if data_1 should come after data_2 @n
+ *
+ * @param[in,out] list          unrolled linked list to add to
+ * @param[in]     data          new data
+ * @param[in]     comp_func     function to compare data with
+ *
+ * @return true  : added successfully
+ * @return false : memory allocation falied
+ */
+extern bool ULListAddByCompare(ULList_t *list, void *data,
+                               int (*comp_func)(const void *, const void *));
+
+/**
+ * @brief
+ *  Replaces the data at the given index of an unrolled linked list.
+ *
+ * @param[in,out] list  unrolled linked list to edit
+ * @param[in]     data  new data
+ * @param[in]     idx   index of the data to replace
+ *
+ * @return true  : edit successful
+ * @return false : invalid index
+ */
+extern bool ULListEditAt(ULList_t *list, void *data, size_t idx);
+
+/**
+ * @brief
+ *  Gets the pointer to data stored in an unrolled linked list by the given
+ *  index.
+ *
+ * @param[in] list  unrolled linked list cointaing the data
+ * @param[in] idx   index to get data from
+ *
+ * @return Pointer to the data, NULL if the index is invalid.
+ */
+extern void *ULListDataAt(const ULList_t *list, size_t idx);
+
+/**
+ * @brief
+ *  Gets the first instance of matching data in an unrolled linked list using
+ *  a given key and compare function.
+ *
+ * @note
+ *  The compare function must return 0 when keys match, and not 0 when it
+ *  doesn't. @n
+ *  Compare function input No. : @n
+ *  1) data from the unrolled linked list @n
+ *  2) key @n
+ *
+ * @param[in] list          unrolled linked list to search
+ * @param[in] key           key to compare the data with
+ * @param[in] comp_func     function to compare data and key
+ *
+ * @return Pointer to the data, NULL if data is not found
+ */
+extern void *ULListData(const ULList_t *list, const void *key,
+                        int (*comp_func)(const void *, const void *));
+
+/**
+ * @brief
+ *  Gets the index of the first data in an unrolled linked list matching a
+ *  given key.
+ *
+ * @note
+ *  The compare function must return 0 when keys match, and not 0 when it
+ *  doesn't. @n
+ *  Compare function input No. : @n
+ *  1) data from the unrolled linked list @n
+ *  2) key @n
+ *
+ * @param[in]  list         unrolled linked list to search
+ * @param[in]  key          key to compare the data with
+ * @param[out] idx          variable to store index found
+ * @param[in]  comp_func    function to compare data and key
+ *
+ * @return true  : data found
+ * @return false : no data matches the key
+ */
+extern bool ULListFindIdx(const ULList_t *list, const void *key, size_t *idx,
+                          int (*comp_func)(const void *, const void *));
+
+/**
+ * @brief
+ *  Traverses through an unrolled linked list head to tail and preforms a
+ *  given function on all its data.
+ *
+ * @param[in,out] list  unrolled linked list to traverse
+ * @param[in]     func  function to preform on data
+ */
+extern void ULListTraverse(ULList_t *list, void (*func)(void *));
+
+/**
+ * @brief
+ *  Copies data from an unrolled linked list to an array.
+ *
+ * @note
+ *  Only works if all data (not the data pointers) in the unrolled linked
+ *  list have uniform size.
+ *
+ * @param[in]  list         unrolled linked list to copy from
+ * @param[out] arr          array to store copied data
+ * @param[in]  len          array length
+ * @param[in]  item_size    array element size
+ */
+extern void ULListToArr(const ULList_t *list, void *arr, size_t len,
+                        size_t item_size);
+
+/**
+ * @brief
+ *  Copies the pointers to data from an unrolled linked list to an array.
+ *
+ * @param[in]  list     unrolled linked list to copy from
+ * @param[out] arr      array to store copied pointers
+ * @param[in]  len      array length
+ */
+extern void ULListToPointerArr(const ULList_t *list, void **arr, size_t len);
+#endif
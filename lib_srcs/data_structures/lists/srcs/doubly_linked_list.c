@@ -15,26 +15,47 @@
 #include "doubly_linked_list.h"
 #include "_extend_doubly_linked_list.h"
 #include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
 DLList_t *DLListCreate() { return calloc(1, sizeof(DLList_t)); }
 
+DLList_t *DLListCreatePooled(NodePool_t *pool)
+{
+    DLList_t *new_list = calloc(1, sizeof(DLList_t));
+    if (new_list == NULL) {
+        return NULL;
+    }
+    new_list->pool = NodePoolAcquire(pool, sizeof(DLListNode_t));
+    if (new_list->pool == NULL) {
+        free(new_list);
+        return NULL;
+    }
+    return new_list;
+}
+
 void DLListClear(DLList_t **p_list, void (*free_data)(void *))
 {
     assert(p_list != NULL);
     assert(*p_list != NULL);
 
-    DLListNode_t *curr_node = (*p_list)->head;
+    DLList_t *list = *p_list;
+    bool is_sole = NodePoolIsSole(list->pool);
+    DLListNode_t *curr_node
+        = (free_data != NULL || !is_sole) ? list->head : NULL;
     while (curr_node != NULL) {
         DLListNode_t *prev = curr_node;
         curr_node = curr_node->next;
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolRelease(list->pool, prev);
+    }
+    if (list->pool != NULL) {
+        NodePoolClear(&list->pool);
     }
-    free(*p_list);
+    free(list);
     *p_list = NULL;
 }
 
@@ -58,7 +79,7 @@ void DLListRemove(DLList_t *list, DLListNode_t *node,
     if (free_data != NULL) {
         free_data(node->data);
     }
-    free(node);
+    NodePoolFree(list->pool, node);
 }
 
 void DLListRemoveAll(DLList_t *list, void (*free_data)(void *))
@@ -72,16 +93,18 @@ void DLListRemoveAll(DLList_t *list, void (*free_data)(void *))
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolFree(list->pool, prev);
     }
+    NodePool_t *pool = list->pool;
     memset(list, 0, sizeof(DLList_t));
+    list->pool = pool;
 }
 
 DLListNode_t *DLListAddHead(DLList_t *list, void *data)
 {
     assert(list != NULL);
 
-    DLListNode_t *new_head = calloc(1, sizeof(DLListNode_t));
+    DLListNode_t *new_head = NodePoolAlloc(list->pool, sizeof(DLListNode_t));
     if (new_head == NULL) {
         return NULL;
     }
@@ -102,7 +125,7 @@ DLListNode_t *DLListAddTail(DLList_t *list, void *data)
 {
     assert(list != NULL);
 
-    DLListNode_t *new_tail = calloc(1, sizeof(DLListNode_t));
+    DLListNode_t *new_tail = NodePoolAlloc(list->pool, sizeof(DLListNode_t));
     if (new_tail == NULL) {
         return NULL;
     }
@@ -125,7 +148,7 @@ DLListNode_t *DLListAddAt(DLList_t *list,
     assert(list != NULL);
     assert(curr_node != NULL);
 
-    DLListNode_t *new_node = calloc(1, sizeof(DLListNode_t));
+    DLListNode_t *new_node = NodePoolAlloc(list->pool, sizeof(DLListNode_t));
     if (new_node == NULL) {
         return NULL;
     }
@@ -155,7 +178,7 @@ DLListNode_t *DLListAddByCompare(DLList_t *list, void *data,
     assert(list != NULL);
     assert(comp_func != NULL);
 
-    DLListNode_t *new_node = calloc(1, sizeof(DLListNode_t));
+    DLListNode_t *new_node = NodePoolAlloc(list->pool, sizeof(DLListNode_t));
     if (new_node == NULL) {
         return NULL;
     }
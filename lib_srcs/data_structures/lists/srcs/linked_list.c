@@ -18,21 +18,40 @@
 
 LList_t *LListCreate() { return calloc(1, sizeof(LList_t)); }
 
+LList_t *LListCreatePooled(NodePool_t *pool)
+{
+    LList_t *new_list = calloc(1, sizeof(LList_t));
+    if (new_list == NULL) {
+        return NULL;
+    }
+    new_list->pool = NodePoolAcquire(pool, sizeof(LListNode_t));
+    if (new_list->pool == NULL) {
+        free(new_list);
+        return NULL;
+    }
+    return new_list;
+}
+
 void LListClear(LList_t **p_list, void (*free_data)(void *))
 {
     assert(p_list != NULL);
     assert(*p_list != NULL);
 
-    LListNode_t *curr = (*p_list)->head;
+    LList_t *list = *p_list;
+    bool is_sole = NodePoolIsSole(list->pool);
+    LListNode_t *curr = (free_data != NULL || !is_sole) ? list->head : NULL;
     while (curr != NULL) {
         LListNode_t *prev = curr;
         curr = curr->next;
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolRelease(list->pool, prev);
+    }
+    if (list->pool != NULL) {
+        NodePoolClear(&list->pool);
     }
-    free(*p_list);
+    free(list);
     *p_list = NULL;
 }
 
@@ -52,7 +71,7 @@ bool LListRemoveHead(LList_t *list, void (*free_data)(void *))
     if (free_data != NULL) {
         free_data(prev_head->data);
     }
-    free(prev_head);
+    NodePoolFree(list->pool, prev_head);
     return true;
 }
 
@@ -83,7 +102,7 @@ bool LListRemoveAt(LList_t *list, size_t idx, void (*free_data)(void *))
     if (free_data != NULL) {
         free_data(expired->data);
     }
-    free(expired);
+    NodePoolFree(list->pool, expired);
     return true;
 }
 
@@ -98,16 +117,18 @@ void LListRemoveAll(LList_t *list, void (*free_data)(void *))
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolFree(list->pool, prev);
     }
+    NodePool_t *pool = list->pool;
     memset(list, 0, sizeof(LList_t));
+    list->pool = pool;
 }
 
 bool LListAddHead(LList_t *list, void *data)
 {
     assert(list != NULL);
 
-    LListNode_t *new_head = calloc(1, sizeof(LListNode_t));
+    LListNode_t *new_head = NodePoolAlloc(list->pool, sizeof(LListNode_t));
     if (new_head == NULL)
         return false;
 
@@ -125,7 +146,7 @@ bool LListAddTail(LList_t *list, void *data)
 {
     assert(list != NULL);
 
-    LListNode_t *new_tail = calloc(1, sizeof(LListNode_t));
+    LListNode_t *new_tail = NodePoolAlloc(list->pool, sizeof(LListNode_t));
     if (new_tail == NULL)
         return false;
 
@@ -147,7 +168,7 @@ int LListAddAt(LList_t *list, void *data, size_t idx)
     if (idx >= list->count)
         return -1;
 
-    LListNode_t *new_node = calloc(1, sizeof(LListNode_t));
+    LListNode_t *new_node = NodePoolAlloc(list->pool, sizeof(LListNode_t));
     if (new_node == NULL)
         return 0;
 
@@ -173,7 +194,7 @@ bool LListAddByCompare(LList_t *list, void *data,
     assert(list != NULL);
     assert(comp_func != NULL);
 
-    LListNode_t *new_node = calloc(1, sizeof(LListNode_t));
+    LListNode_t *new_node = NodePoolAlloc(list->pool, sizeof(LListNode_t));
     if (new_node == NULL)
         return false;
 
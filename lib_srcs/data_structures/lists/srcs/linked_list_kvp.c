@@ -25,13 +25,35 @@ LListKVP_t *LListKVPCreate(int (*comp_key)(const void *, const void *))
     return new_list;
 }
 
+LListKVP_t *LListKVPCreatePooled(int (*comp_key)(const void *, const void *),
+                                 NodePool_t *pool)
+{
+    assert(comp_key != NULL);
+
+    LListKVP_t *new_list = calloc(1, sizeof(LListKVP_t));
+    if (new_list == NULL) {
+        return NULL;
+    }
+    new_list->pool = NodePoolAcquire(pool, sizeof(LListKVPNode_t));
+    if (new_list->pool == NULL) {
+        free(new_list);
+        return NULL;
+    }
+    new_list->comp_key = comp_key;
+    return new_list;
+}
+
 void LListKVPClear(LListKVP_t **p_list, void (*free_key)(void *),
                    void (*free_data)(void *))
 {
     assert(p_list != NULL);
     assert(*p_list != NULL);
 
-    LListKVPNode_t *curr = (*p_list)->head;
+    LListKVP_t *list = *p_list;
+    bool is_sole = NodePoolIsSole(list->pool);
+    LListKVPNode_t *curr
+        = (free_key != NULL || free_data != NULL || !is_sole) ? list->head
+                                                               : NULL;
     while (curr != NULL) {
         LListKVPNode_t *prev = curr;
         curr = curr->next;
@@ -41,9 +63,12 @@ void LListKVPClear(LListKVP_t **p_list, void (*free_key)(void *),
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolRelease(list->pool, prev);
     }
-    free(*p_list);
+    if (list->pool != NULL) {
+        NodePoolClear(&list->pool);
+    }
+    free(list);
     *p_list = NULL;
 }
 
@@ -68,7 +93,7 @@ bool LListKVPRemoveHead(LListKVP_t *list, void (*free_key)(void *),
     if (free_data != NULL) {
         free_data(prev_head->data);
     }
-    free(prev_head);
+    NodePoolFree(list->pool, prev_head);
     return true;
 }
 
@@ -100,7 +125,7 @@ void *LListKVPRemove(LListKVP_t *list, void *key, void (*free_key)(void *))
         free_key(expired->key);
     }
     data = expired->data;
-    free(expired);
+    NodePoolFree(list->pool, expired);
     return data;
 }
 
@@ -119,16 +144,19 @@ void LListKVPRemoveAll(LListKVP_t *list, void (*free_key)(void *),
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolFree(list->pool, prev);
     }
+    NodePool_t *pool = list->pool;
     memset(list, 0, sizeof(LListKVP_t));
+    list->pool = pool;
 }
 
 bool LListKVPAddHead(LListKVP_t *list, void *key, void *data)
 {
     assert(list != NULL);
 
-    LListKVPNode_t *new_head = calloc(1, sizeof(LListKVPNode_t));
+    LListKVPNode_t *new_head
+        = NodePoolAlloc(list->pool, sizeof(LListKVPNode_t));
     if (new_head == NULL) {
         return false;
     }
@@ -148,7 +176,8 @@ bool LListKVPAddTail(LListKVP_t *list, void *key, void *data)
 {
     assert(list != NULL);
 
-    LListKVPNode_t *new_tail = calloc(1, sizeof(LListKVPNode_t));
+    LListKVPNode_t *new_tail
+        = NodePoolAlloc(list->pool, sizeof(LListKVPNode_t));
     if (new_tail == NULL) {
         return false;
     }
@@ -169,7 +198,8 @@ bool LListKVPAdd(LListKVP_t *list, void *key, void *data)
 {
     assert(list != NULL);
 
-    LListKVPNode_t *new_node = calloc(1, sizeof(LListKVPNode_t));
+    LListKVPNode_t *new_node
+        = NodePoolAlloc(list->pool, sizeof(LListKVPNode_t));
     if (new_node == NULL) {
         return false;
     }
@@ -188,12 +218,43 @@ bool LListKVPAdd(LListKVP_t *list, void *key, void *data)
     if (curr == NULL) {
         list->tail = new_node;
     }
+    new_node->key = key;
     new_node->data = data;
     new_node->next = curr;
     list->count += 1;
     return true;
 }
 
+void LListKVPAddNode(LListKVP_t *list, LListKVPNode_t *node)
+{
+    assert(list != NULL);
+    assert(node != NULL);
+
+    list->count += 1;
+    if (list->tail == NULL || list->comp_key(list->tail->key, node->key) <= 0) {
+        node->next = NULL;
+        if (list->tail == NULL) {
+            list->head = node;
+        } else {
+            list->tail->next = node;
+        }
+        list->tail = node;
+        return;
+    }
+    LListKVPNode_t *prev = NULL;
+    LListKVPNode_t *curr = list->head;
+    while (list->comp_key(curr->key, node->key) < 0) {
+        prev = curr;
+        curr = curr->next;
+    }
+    if (prev == NULL) {
+        list->head = node;
+    } else {
+        prev->next = node;
+    }
+    node->next = curr;
+}
+
 void *LListKVPFind(LListKVP_t *list, const void *key)
 {
     assert(list != NULL);
@@ -202,6 +263,9 @@ void *LListKVPFind(LListKVP_t *list, const void *key)
     while (curr != NULL && list->comp_key(curr->key, key) != 0) {
         curr = curr->next;
     }
+    if (curr == NULL) {
+        return NULL;
+    }
     return curr->data;
 }
 
@@ -20,11 +20,26 @@ LListQueue_t *LListQueueCreate()
     return calloc(1, sizeof(LListQueue_t));
 }
 
+LListQueue_t *LListQueueCreatePooled(NodePool_t *pool)
+{
+    LListQueue_t *new_queue = calloc(1, sizeof(LListQueue_t));
+    if (new_queue == NULL) {
+        return NULL;
+    }
+    new_queue->pool = NodePoolAcquire(pool, sizeof(LListQueueNode_t));
+    if (new_queue->pool == NULL) {
+        free(new_queue);
+        return NULL;
+    }
+    return new_queue;
+}
+
 bool LListQueueEnqueue(LListQueue_t *queue, void *data)
 {
     assert(queue != NULL);
 
-    LListQueueNode_t *new_tail = calloc(1, sizeof(LListQueueNode_t));
+    LListQueueNode_t *new_tail
+        = NodePoolAlloc(queue->pool, sizeof(LListQueueNode_t));
     if (new_tail == NULL) {
         return false;
     }
@@ -53,7 +68,7 @@ void *LListQueueDequeue(LListQueue_t *queue)
     }
     data = prev_head->data;
     queue->head = queue->head->next;
-    free(prev_head);
+    NodePoolFree(queue->pool, prev_head);
     return data;
 }
 
@@ -62,15 +77,21 @@ void LListQueueClear(LListQueue_t **p_queue, void (*free_data)(void *))
     assert(p_queue != NULL);
     assert(*p_queue != NULL);
 
-    LListQueueNode_t *curr = (*p_queue)->head;
+    LListQueue_t *queue = *p_queue;
+    bool is_sole = NodePoolIsSole(queue->pool);
+    LListQueueNode_t *curr
+        = (free_data != NULL || !is_sole) ? queue->head : NULL;
     while (curr != NULL) {
         LListQueueNode_t *prev = curr;
         curr = curr->next;
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolRelease(queue->pool, prev);
+    }
+    if (queue->pool != NULL) {
+        NodePoolClear(&queue->pool);
     }
-    free(*p_queue);
+    free(queue);
     *p_queue = NULL;
 }
\ No newline at end of file
@@ -20,11 +20,26 @@ LListStack_t *LListStackCreate()
     return calloc(1, sizeof(LListStack_t));
 }
 
+LListStack_t *LListStackCreatePooled(NodePool_t *pool)
+{
+    LListStack_t *new_stack = calloc(1, sizeof(LListStack_t));
+    if (new_stack == NULL) {
+        return NULL;
+    }
+    new_stack->pool = NodePoolAcquire(pool, sizeof(LListStackNode_t));
+    if (new_stack->pool == NULL) {
+        free(new_stack);
+        return NULL;
+    }
+    return new_stack;
+}
+
 bool LListStackPush(LListStack_t *stack, void *data)
 {
     assert(stack != NULL);
 
-    LListStackNode_t *new_head = calloc(1, sizeof(LListStackNode_t));
+    LListStackNode_t *new_head
+        = NodePoolAlloc(stack->pool, sizeof(LListStackNode_t));
     if (new_head == NULL) {
         return false;
     }
@@ -52,7 +67,7 @@ void *LListStackPop(LListStack_t *stack)
     }
     data = prev_head->data;
     stack->head = stack->head->next;
-    free(prev_head);
+    NodePoolFree(stack->pool, prev_head);
     return data;
 }
 
@@ -61,15 +76,21 @@ void LListStackClear(LListStack_t **p_stack, void (*free_data)(void *))
     assert(p_stack != NULL);
     assert(*p_stack != NULL);
 
-    LListStackNode_t *curr = (*p_stack)->head;
+    LListStack_t *stack = *p_stack;
+    bool is_sole = NodePoolIsSole(stack->pool);
+    LListStackNode_t *curr
+        = (free_data != NULL || !is_sole) ? stack->head : NULL;
     while (curr != NULL) {
         LListStackNode_t *prev = curr;
         curr = curr->next;
         if (free_data != NULL) {
             free_data(prev->data);
         }
-        free(prev);
+        NodePoolRelease(stack->pool, prev);
+    }
+    if (stack->pool != NULL) {
+        NodePoolClear(&stack->pool);
     }
-    free(*p_stack);
+    free(stack);
     *p_stack = NULL;
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+/**
+ * @file mpmc_queue.c
+ *
+ * @brief
+ *  Structs and functions for bounded multi-producer multi-consumer queues.
+ *
+ * @implements
+ *  mpmc_queue.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "mpmc_queue.h"
+#include <assert.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static size_t _claim(MpmcQueue_t *queue, _Atomic size_t *index, size_t lap,
+                     size_t max_count, size_t *p_pos);
+
+MpmcQueue_t *MpmcQueueCreate(size_t capacity)
+{
+    size_t cell_count = 2;
+    while (cell_count < capacity) {
+        cell_count <<= 1;
+    }
+    MpmcQueue_t *queue = aligned_alloc(MPMC_QUEUE_ALIGN, sizeof(MpmcQueue_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->cells = malloc(cell_count * sizeof(MpmcQueueCell_t));
+    if (queue->cells == NULL) {
+        free(queue);
+        return NULL;
+    }
+    for (size_t i = 0; i < cell_count; i++) {
+        atomic_init(&queue->cells[i].seq, i);
+        queue->cells[i].data = NULL;
+    }
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->mask = cell_count - 1;
+    return queue;
+}
+
+void MpmcQueueClear(MpmcQueue_t **p_queue, void (*free_data)(void *))
+{
+    assert(p_queue != NULL);
+    assert(*p_queue != NULL);
+
+    MpmcQueue_t *queue = *p_queue;
+    if (free_data != NULL) {
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        for (; head != tail; head++) {
+            free_data(queue->cells[head & queue->mask].data);
+        }
+    }
+    free(queue->cells);
+    free(queue);
+    *p_queue = NULL;
+}
+
+bool MpmcQueueTryEnqueue(MpmcQueue_t *queue, void *data)
+{
+    return MpmcQueueTryEnqueueMany(queue, &data, 1) == 1;
+}
+
+void MpmcQueueEnqueue(MpmcQueue_t *queue, void *data)
+{
+    while (!MpmcQueueTryEnqueue(queue, data)) {
+        sched_yield();
+    }
+}
+
+size_t MpmcQueueTryEnqueueMany(MpmcQueue_t *queue, void **data_arr,
+                               size_t count)
+{
+    assert(queue != NULL);
+    assert(data_arr != NULL || count == 0);
+
+    size_t pos;
+    size_t claimed = _claim(queue, &queue->tail, 0, count, &pos);
+    for (size_t i = 0; i < claimed; i++) {
+        MpmcQueueCell_t *cell = &queue->cells[(pos + i) & queue->mask];
+        cell->data = data_arr[i];
+        atomic_store_explicit(&cell->seq, pos + i + 1, memory_order_release);
+    }
+    return claimed;
+}
+
+void *MpmcQueueTryDequeue(MpmcQueue_t *queue)
+{
+    void *data = NULL;
+    MpmcQueueTryDequeueMany(queue, &data, 1);
+    return data;
+}
+
+void *MpmcQueueDequeue(MpmcQueue_t *queue)
+{
+    void *data;
+    while (MpmcQueueTryDequeueMany(queue, &data, 1) == 0) {
+        sched_yield();
+    }
+    return data;
+}
+
+size_t MpmcQueueTryDequeueMany(MpmcQueue_t *queue, void **data_arr,
+                               size_t count)
+{
+    assert(queue != NULL);
+    assert(data_arr != NULL || count == 0);
+
+    size_t pos;
+    size_t claimed = _claim(queue, &queue->head, 1, count, &pos);
+    for (size_t i = 0; i < claimed; i++) {
+        MpmcQueueCell_t *cell = &queue->cells[(pos + i) & queue->mask];
+        data_arr[i] = cell->data;
+        // ready for the enqueue one lap later
+        atomic_store_explicit(&cell->seq, pos + i + queue->mask + 1,
+                              memory_order_release);
+    }
+    return claimed;
+}
+
+size_t MpmcQueueCount(MpmcQueue_t *queue)
+{
+    assert(queue != NULL);
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t count = tail - head;
+    // the relaxed loads can see a tail older than a head that dequeues moved
+    // past it, wrapping the difference, or a head older than enqueues that
+    // refilled the queue; neither is a real count
+    if (count > SIZE_MAX / 2) {
+        return 0;
+    }
+    return count <= queue->mask ? count : queue->mask + 1;
+}
+
+/**
+ * @brief
+ *  Claims up to max_count consecutive positions from the tail (lap 0) or
+ *  head (lap 1), as far as their cells have the sequence number of the
+ *  position plus lap. Sets p_pos to the first position claimed.
+ */
+static size_t _claim(MpmcQueue_t *queue, _Atomic size_t *index, size_t lap,
+                     size_t max_count, size_t *p_pos)
+{
+    if (max_count == 0) {
+        return 0;
+    }
+    size_t pos = atomic_load_explicit(index, memory_order_relaxed);
+    while (true) {
+        size_t seq = atomic_load_explicit(
+            &queue->cells[pos & queue->mask].seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - (pos + lap));
+        if (diff < 0) {
+            return 0; // full for enqueues, empty for dequeues
+        }
+        if (diff > 0) { // another thread claimed pos first
+            pos = atomic_load_explicit(index, memory_order_relaxed);
+            continue;
+        }
+        size_t count = 1;
+        while (count < max_count
+               && atomic_load_explicit(
+                      &queue->cells[(pos + count) & queue->mask].seq,
+                      memory_order_acquire)
+                      == pos + count + lap) {
+            count += 1;
+        }
+        if (atomic_compare_exchange_weak_explicit(index, &pos, pos + count,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            *p_pos = pos;
+            return count;
+        }
+    }
+}
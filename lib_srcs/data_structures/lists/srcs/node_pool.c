@@ -0,0 +1,146 @@
+/**
+ * @file node_pool.c
+ *
+ * @brief
+ *  Structs and functions for node pools.
+ *
+ * @implements
+ *  node_pool.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "node_pool.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void *_allocFromSlab(NodePool_t *pool);
+
+NodePool_t *NodePoolCreate(size_t node_size, size_t slab_nodes)
+{
+    assert(slab_nodes > 0);
+
+    NodePool_t *pool = calloc(1, sizeof(NodePool_t));
+    if (pool == NULL) {
+        return NULL;
+    }
+    // freed nodes hold the free list link, so must fit and align a pointer
+    node_size = (node_size + sizeof(void *) - 1) / sizeof(void *)
+                * sizeof(void *);
+    if (node_size == 0) {
+        node_size = sizeof(void *);
+    }
+    pool->node_size = node_size;
+    pool->slab_nodes = slab_nodes;
+    pool->refs = 1;
+    return pool;
+}
+
+void NodePoolClear(NodePool_t **p_pool)
+{
+    assert(p_pool != NULL);
+    assert(*p_pool != NULL);
+
+    NodePool_t *pool = *p_pool;
+    *p_pool = NULL;
+    if (--pool->refs > 0) {
+        return;
+    }
+    NodePoolSlab_t *slab = pool->slabs;
+    while (slab != NULL) {
+        NodePoolSlab_t *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+NodePool_t *NodePoolShare(NodePool_t *pool)
+{
+    assert(pool != NULL);
+
+    pool->refs += 1;
+    return pool;
+}
+
+NodePool_t *NodePoolAcquire(NodePool_t *pool, size_t node_size)
+{
+    if (pool == NULL) {
+        return NodePoolCreate(node_size, NODE_POOL_SLAB_NODES);
+    }
+    assert(node_size <= pool->node_size);
+
+    return NodePoolShare(pool);
+}
+
+void *NodePoolAlloc(NodePool_t *pool, size_t node_size)
+{
+    if (pool == NULL) {
+        return calloc(1, node_size);
+    }
+    assert(node_size <= pool->node_size);
+
+    void *node = pool->free_list;
+    if (node != NULL) {
+        memcpy(&pool->free_list, node, sizeof(void *));
+    } else {
+        node = _allocFromSlab(pool);
+        if (node == NULL) {
+            return NULL;
+        }
+    }
+    memset(node, 0, node_size);
+    pool->used += 1;
+    return node;
+}
+
+void NodePoolFree(NodePool_t *pool, void *node)
+{
+    if (pool == NULL) {
+        free(node);
+        return;
+    }
+    if (node == NULL) {
+        return;
+    }
+    memcpy(node, &pool->free_list, sizeof(void *));
+    pool->free_list = node;
+    pool->used -= 1;
+}
+
+bool NodePoolIsSole(const NodePool_t *pool)
+{
+    return pool != NULL && pool->refs == 1;
+}
+
+void NodePoolRelease(NodePool_t *pool, void *node)
+{
+    if (!NodePoolIsSole(pool)) {
+        NodePoolFree(pool, node);
+    }
+}
+
+/**
+ * @brief
+ *  Takes the next never used node of the newest slab, allocating a new slab
+ *  if it has none left.
+ */
+static void *_allocFromSlab(NodePool_t *pool)
+{
+    if (pool->bump == pool->bump_end) {
+        NodePoolSlab_t *slab = malloc(sizeof(NodePoolSlab_t)
+                                      + pool->slab_nodes * pool->node_size);
+        if (slab == NULL) {
+            return NULL;
+        }
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        pool->bump = (char *)(slab + 1);
+        pool->bump_end = pool->bump + pool->slab_nodes * pool->node_size;
+    }
+    void *node = pool->bump;
+    pool->bump += pool->node_size;
+    return node;
+}
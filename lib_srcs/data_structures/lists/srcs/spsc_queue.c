@@ -0,0 +1,132 @@
+/**
+ * @file spsc_queue.c
+ *
+ * @brief
+ *  Structs and functions for bounded single-producer single-consumer queues.
+ *
+ * @implements
+ *  spsc_queue.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "spsc_queue.h"
+#include <assert.h>
+#include <stdlib.h>
+
+SpscQueue_t *SpscQueueCreate(size_t capacity)
+{
+    size_t data_count = 2;
+    while (data_count < capacity) {
+        data_count <<= 1;
+    }
+    SpscQueue_t *queue = aligned_alloc(SPSC_QUEUE_ALIGN, sizeof(SpscQueue_t));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->data = malloc(data_count * sizeof(void *));
+    if (queue->data == NULL) {
+        free(queue);
+        return NULL;
+    }
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->head_cache = 0;
+    queue->tail_cache = 0;
+    queue->mask = data_count - 1;
+    return queue;
+}
+
+void SpscQueueClear(SpscQueue_t **p_queue, void (*free_data)(void *))
+{
+    assert(p_queue != NULL);
+    assert(*p_queue != NULL);
+
+    SpscQueue_t *queue = *p_queue;
+    if (free_data != NULL) {
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        for (; head != tail; head++) {
+            free_data(queue->data[head & queue->mask]);
+        }
+    }
+    free(queue->data);
+    free(queue);
+    *p_queue = NULL;
+}
+
+bool SpscQueueEnqueue(SpscQueue_t *queue, void *data)
+{
+    return SpscQueueEnqueueMany(queue, &data, 1) == 1;
+}
+
+size_t SpscQueueEnqueueMany(SpscQueue_t *queue, void **data_arr, size_t count)
+{
+    assert(queue != NULL);
+    assert(data_arr != NULL || count == 0);
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t space = queue->mask + 1 - (tail - queue->head_cache);
+    if (space < count) {
+        queue->head_cache
+            = atomic_load_explicit(&queue->head, memory_order_acquire);
+        space = queue->mask + 1 - (tail - queue->head_cache);
+    }
+    if (count > space) {
+        count = space;
+    }
+    for (size_t i = 0; i < count; i++) {
+        queue->data[(tail + i) & queue->mask] = data_arr[i];
+    }
+    if (count > 0) {
+        atomic_store_explicit(&queue->tail, tail + count,
+                              memory_order_release);
+    }
+    return count;
+}
+
+void *SpscQueueDequeue(SpscQueue_t *queue)
+{
+    void *data = NULL;
+    SpscQueueDequeueMany(queue, &data, 1);
+    return data;
+}
+
+size_t SpscQueueDequeueMany(SpscQueue_t *queue, void **data_arr, size_t count)
+{
+    assert(queue != NULL);
+    assert(data_arr != NULL || count == 0);
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t ready = queue->tail_cache - head;
+    if (ready < count) {
+        queue->tail_cache
+            = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        ready = queue->tail_cache - head;
+    }
+    if (count > ready) {
+        count = ready;
+    }
+    for (size_t i = 0; i < count; i++) {
+        data_arr[i] = queue->data[(head + i) & queue->mask];
+    }
+    if (count > 0) {
+        atomic_store_explicit(&queue->head, head + count,
+                              memory_order_release);
+    }
+    return count;
+}
+
+size_t SpscQueueCount(SpscQueue_t *queue)
+{
+    assert(queue != NULL);
+
+    // the consumer only moves head up to a tail it acquired before its
+    // release store, so acquiring head keeps the tail read after it from
+    // being behind; the producer can still refill the queue in between
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t count = tail - head;
+    return count <= queue->mask ? count : queue->mask + 1;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file treiber_stack.c
+ *
+ * @brief
+ *  Structs and functions for bounded lock-free Treiber stacks.
+ *
+ * @implements
+ *  treiber_stack.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "treiber_stack.h"
+#include <assert.h>
+#include <stdlib.h>
+
+#define NIL UINT32_MAX      // index of no node
+#define OFFER_EMPTY 0
+#define OFFER_TAKEN UINT64_MAX
+
+static bool _tryPushIdx(TreiberStack_t *stack, _Atomic uint64_t *head,
+                        uint32_t idx);
+static int _tryPopIdx(TreiberStack_t *stack, _Atomic uint64_t *head,
+                      uint32_t *idx);
+static void _freeNode(TreiberStack_t *stack, uint32_t idx);
+static TreiberStackSlot_t *_pickSlot(TreiberStack_t *stack);
+static bool _offer(TreiberStack_t *stack, uint32_t idx);
+static bool _take(TreiberStack_t *stack, void **data);
+
+TreiberStack_t *TreiberStackCreate(size_t capacity)
+{
+    assert(capacity < NIL);
+
+    TreiberStack_t *stack
+        = aligned_alloc(TREIBER_STACK_ALIGN, sizeof(TreiberStack_t));
+    if (stack == NULL) {
+        return NULL;
+    }
+    stack->nodes = malloc(capacity * sizeof(TreiberStackNode_t));
+    if (stack->nodes == NULL && capacity > 0) {
+        free(stack);
+        return NULL;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        stack->nodes[i].data = NULL;
+        atomic_init(&stack->nodes[i].next, i + 1 < capacity ? i + 1 : NIL);
+    }
+    for (size_t i = 0; i < TREIBER_STACK_ELIM_SLOTS; i++) {
+        atomic_init(&stack->slots[i].offer, OFFER_EMPTY);
+    }
+    atomic_init(&stack->head, NIL);
+    atomic_init(&stack->free_head, capacity > 0 ? 0 : NIL);
+    stack->capacity = capacity;
+    return stack;
+}
+
+bool TreiberStackPush(TreiberStack_t *stack, void *data)
+{
+    assert(stack != NULL);
+
+    uint32_t idx;
+    int res;
+    while ((res = _tryPopIdx(stack, &stack->free_head, &idx)) == 0) {
+    }
+    if (res < 0) {
+        return false;
+    }
+    stack->nodes[idx].data = data;
+    while (!_tryPushIdx(stack, &stack->head, idx)) {
+        if (_offer(stack, idx)) {
+            break;
+        }
+    }
+    return true;
+}
+
+void *TreiberStackPop(TreiberStack_t *stack)
+{
+    assert(stack != NULL);
+
+    uint32_t idx;
+    int res;
+    while ((res = _tryPopIdx(stack, &stack->head, &idx)) == 0) {
+        void *data;
+        if (_take(stack, &data)) {
+            return data;
+        }
+    }
+    if (res < 0) {
+        return NULL;
+    }
+    void *data = stack->nodes[idx].data;
+    _freeNode(stack, idx);
+    return data;
+}
+
+void TreiberStackClear(TreiberStack_t **p_stack, void (*free_data)(void *))
+{
+    assert(p_stack != NULL);
+    assert(*p_stack != NULL);
+
+    TreiberStack_t *stack = *p_stack;
+    if (free_data != NULL) {
+        uint32_t idx = (uint32_t)atomic_load_explicit(&stack->head,
+                                                      memory_order_relaxed);
+        while (idx != NIL) {
+            free_data(stack->nodes[idx].data);
+            idx = atomic_load_explicit(&stack->nodes[idx].next,
+                                       memory_order_relaxed);
+        }
+    }
+    free(stack->nodes);
+    free(stack);
+    *p_stack = NULL;
+}
+
+/**
+ * @brief
+ *  Tries once to push a node onto the stack at the given head.
+ *
+ * @return true  : pushed
+ * @return false : lost a race with another thread
+ */
+static bool _tryPushIdx(TreiberStack_t *stack, _Atomic uint64_t *head,
+                        uint32_t idx)
+{
+    uint64_t old_head = atomic_load_explicit(head, memory_order_relaxed);
+    atomic_store_explicit(&stack->nodes[idx].next, (uint32_t)old_head,
+                          memory_order_relaxed);
+    uint64_t new_head = ((old_head >> 32) + 1) << 32 | idx;
+    return atomic_compare_exchange_weak_explicit(head, &old_head, new_head,
+                                                 memory_order_release,
+                                                 memory_order_relaxed);
+}
+
+/**
+ * @brief
+ *  Tries once to pop the top node off the stack at the given head.
+ *
+ * @return 1 if popped, 0 if it lost a race with another thread, -1 if the
+ * stack is empty.
+ */
+static int _tryPopIdx(TreiberStack_t *stack, _Atomic uint64_t *head,
+                      uint32_t *idx)
+{
+    uint64_t old_head = atomic_load_explicit(head, memory_order_acquire);
+    *idx = (uint32_t)old_head;
+    if (*idx == NIL) {
+        return -1;
+    }
+    // the node may be popped and pushed again meanwhile, changing next,
+    // but then the tag has changed and the swap fails
+    uint32_t next
+        = atomic_load_explicit(&stack->nodes[*idx].next, memory_order_relaxed);
+    uint64_t new_head = ((old_head >> 32) + 1) << 32 | next;
+    return atomic_compare_exchange_weak_explicit(head, &old_head, new_head,
+                                                 memory_order_acquire,
+                                                 memory_order_relaxed);
+}
+
+/**
+ * @brief
+ *  Returns a node to the free list.
+ */
+static void _freeNode(TreiberStack_t *stack, uint32_t idx)
+{
+    while (!_tryPushIdx(stack, &stack->free_head, idx)) {
+    }
+}
+
+/**
+ * @brief
+ *  Picks an elimination slot, spreading each thread's picks with a
+ *  xorshift state of its own.
+ */
+static TreiberStackSlot_t *_pickSlot(TreiberStack_t *stack)
+{
+    static _Thread_local uint32_t state = 0;
+    if (state == 0) {
+        state = (uint32_t)(uintptr_t)&state | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return &stack->slots[state % TREIBER_STACK_ELIM_SLOTS];
+}
+
+/**
+ * @brief
+ *  Offers a pushed node in an elimination slot, waiting a while for a pop to
+ *  take it.
+ *
+ * @return true  : a pop took the node, which is now its to free
+ * @return false : no pop came, or the slot was in use
+ */
+static bool _offer(TreiberStack_t *stack, uint32_t idx)
+{
+    TreiberStackSlot_t *slot = _pickSlot(stack);
+    uint64_t offer = OFFER_EMPTY;
+    if (!atomic_compare_exchange_strong_explicit(
+            &slot->offer, &offer, (uint64_t)idx + 1, memory_order_release,
+            memory_order_relaxed)) {
+        return false;
+    }
+    for (size_t i = 0; i < TREIBER_STACK_ELIM_SPINS; i++) {
+        if (atomic_load_explicit(&slot->offer, memory_order_relaxed)
+            == OFFER_TAKEN) {
+            atomic_store_explicit(&slot->offer, OFFER_EMPTY,
+                                  memory_order_relaxed);
+            return true;
+        }
+    }
+    offer = (uint64_t)idx + 1;
+    if (atomic_compare_exchange_strong_explicit(
+            &slot->offer, &offer, OFFER_EMPTY, memory_order_relaxed,
+            memory_order_relaxed)) {
+        return false;
+    }
+    // taken between the last check and the withdrawal
+    atomic_store_explicit(&slot->offer, OFFER_EMPTY, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief
+ *  Takes the data of a node offered in an elimination slot, if there is one,
+ *  and frees the node.
+ *
+ * @return true  : took data
+ * @return false : slot had no offer
+ */
+static bool _take(TreiberStack_t *stack, void **data)
+{
+    TreiberStackSlot_t *slot = _pickSlot(stack);
+    uint64_t offer = atomic_load_explicit(&slot->offer, memory_order_relaxed);
+    if (offer == OFFER_EMPTY || offer == OFFER_TAKEN
+        || !atomic_compare_exchange_strong_explicit(
+            &slot->offer, &offer, OFFER_TAKEN, memory_order_acquire,
+            memory_order_relaxed)) {
+        return false;
+    }
+    uint32_t idx = (uint32_t)(offer - 1);
+    *data = stack->nodes[idx].data;
+    _freeNode(stack, idx);
+    return true;
+}
@@ -0,0 +1,367 @@
+/**
+ * @file unrolled_linked_list.c
+ *
+ * @brief
+ *  Structs and functions for unrolled linked lists.
+ *
+ * @implements
+ *  unrolled_linked_list.h
+ *
+ * @author Pokpong
+ * @version 0.1
+ * @date 2026-10-17
+ */
+#include "unrolled_linked_list.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+static ULListNode_t *_createNode();
+static ULListNode_t *_findNode(const ULList_t *list, size_t *idx,
+                               ULListNode_t **p_prev);
+static bool _insertInNode(ULList_t *list, ULListNode_t *node, size_t pos,
+                          void *data);
+static void _removeFromNode(ULList_t *list, ULListNode_t *prev,
+                            ULListNode_t *node, size_t pos,
+                            void (*free_data)(void *));
+
+ULList_t *ULListCreate()
+{
+    return calloc(1, sizeof(ULList_t));
+}
+
+void ULListClear(ULList_t **p_list, void (*free_data)(void *))
+{
+    assert(p_list != NULL);
+    assert(*p_list != NULL);
+
+    ULListRemoveAll(*p_list, free_data);
+    free(*p_list);
+    *p_list = NULL;
+}
+
+bool ULListRemoveHead(ULList_t *list, void (*free_data)(void *))
+{
+    assert(list != NULL);
+
+    if (list->count == 0) {
+        return false;
+    }
+    _removeFromNode(list, NULL, list->head, 0, free_data);
+    return true;
+}
+
+bool ULListRemoveAt(ULList_t *list, size_t idx, void (*free_data)(void *))
+{
+    assert(list != NULL);
+
+    if (idx >= list->count) {
+        return false;
+    }
+    ULListNode_t *prev = NULL;
+    ULListNode_t *node = _findNode(list, &idx, &prev);
+    _removeFromNode(list, prev, node, idx, free_data);
+    return true;
+}
+
+void ULListRemoveAll(ULList_t *list, void (*free_data)(void *))
+{
+    assert(list != NULL);
+
+    ULListNode_t *curr = list->head;
+    while (curr != NULL) {
+        ULListNode_t *next = curr->next;
+        if (free_data != NULL) {
+            for (size_t i = 0; i < curr->count; i++) {
+                free_data(curr->data[i]);
+            }
+        }
+        free(curr);
+        curr = next;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+bool ULListAddHead(ULList_t *list, void *data)
+{
+    assert(list != NULL);
+
+    if (list->head == NULL || list->head->count == ULLIST_NODE_CAP) {
+        ULListNode_t *new_node = _createNode();
+        if (new_node == NULL) {
+            return false;
+        }
+        new_node->next = list->head;
+        list->head = new_node;
+        if (list->tail == NULL) {
+            list->tail = new_node;
+        }
+    }
+    return _insertInNode(list, list->head, 0, data);
+}
+
+bool ULListAddTail(ULList_t *list, void *data)
+{
+    assert(list != NULL);
+
+    if (list->tail == NULL || list->tail->count == ULLIST_NODE_CAP) {
+        ULListNode_t *new_node = _createNode();
+        if (new_node == NULL) {
+            return false;
+        }
+        if (list->tail == NULL) {
+            list->head = new_node;
+        } else {
+            list->tail->next = new_node;
+        }
+        list->tail = new_node;
+    }
+    return _insertInNode(list, list->tail, list->tail->count, data);
+}
+
+int ULListAddAt(ULList_t *list, void *data, size_t idx)
+{
+    assert(list != NULL);
+
+    if (idx >= list->count) {
+        return -1;
+    }
+    ULListNode_t *node = _findNode(list, &idx, NULL);
+    return _insertInNode(list, node, idx, data) ? 1 : 0;
+}
+
+bool ULListAddByCompare(ULList_t *list, void *data,
+                        int (*comp_func)(const void *, const void *))
+{
+    assert(list != NULL);
+    assert(comp_func != NULL);
+
+    for (ULListNode_t *curr = list->head; curr != NULL; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            if (comp_func(curr->data[i], data) >= 0) {
+                return _insertInNode(list, curr, i, data);
+            }
+        }
+    }
+    return ULListAddTail(list, data);
+}
+
+bool ULListEditAt(ULList_t *list, void *data, size_t idx)
+{
+    assert(list != NULL);
+
+    if (idx >= list->count) {
+        return false;
+    }
+    ULListNode_t *node = _findNode(list, &idx, NULL);
+    node->data[idx] = data;
+    return true;
+}
+
+void *ULListDataAt(const ULList_t *list, size_t idx)
+{
+    assert(list != NULL);
+
+    if (idx >= list->count) {
+        return NULL;
+    }
+    ULListNode_t *node = _findNode(list, &idx, NULL);
+    return node->data[idx];
+}
+
+void *ULListData(const ULList_t *list, const void *key,
+                 int (*comp_func)(const void *, const void *))
+{
+    assert(list != NULL);
+    assert(comp_func != NULL);
+
+    for (ULListNode_t *curr = list->head; curr != NULL; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            if (comp_func(curr->data[i], key) == 0) {
+                return curr->data[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+bool ULListFindIdx(const ULList_t *list, const void *key, size_t *idx,
+                   int (*comp_func)(const void *, const void *))
+{
+    assert(list != NULL);
+    assert(idx != NULL);
+    assert(comp_func != NULL);
+
+    size_t start = 0;
+    for (ULListNode_t *curr = list->head; curr != NULL; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            if (comp_func(curr->data[i], key) == 0) {
+                *idx = start + i;
+                return true;
+            }
+        }
+        start += curr->count;
+    }
+    return false;
+}
+
+void ULListTraverse(ULList_t *list, void (*func)(void *))
+{
+    assert(list != NULL);
+    assert(func != NULL);
+
+    for (ULListNode_t *curr = list->head; curr != NULL; curr = curr->next) {
+        for (size_t i = 0; i < curr->count; i++) {
+            func(curr->data[i]);
+        }
+    }
+}
+
+void ULListToArr(const ULList_t *list, void *arr, size_t len,
+                 size_t item_size)
+{
+    assert(list != NULL);
+    assert(arr != NULL);
+
+    size_t i = 0;
+    ULListNode_t *curr = list->head;
+    for (; curr != NULL && i < len; curr = curr->next) {
+        for (size_t j = 0; j < curr->count && i < len; j++, i++) {
+            memcpy((char *)arr + i * item_size, curr->data[j], item_size);
+        }
+    }
+}
+
+void ULListToPointerArr(const ULList_t *list, void **arr, size_t len)
+{
+    assert(list != NULL);
+    assert(arr != NULL);
+
+    size_t i = 0;
+    ULListNode_t *curr = list->head;
+    for (; curr != NULL && i < len; curr = curr->next) {
+        size_t copy_count = curr->count;
+        if (copy_count > len - i) {
+            copy_count = len - i;
+        }
+        memcpy(arr + i, curr->data, copy_count * sizeof(void *));
+        i += copy_count;
+    }
+}
+
+/**
+ * @brief
+ *  Allocates an empty node.
+ */
+static ULListNode_t *_createNode()
+{
+    ULListNode_t *node = malloc(sizeof(ULListNode_t));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+/**
+ * @brief
+ *  Finds the node holding a valid index, skipping whole nodes by their
+ *  counts. Sets idx to the position in the node, and the previous node if
+ *  p_prev is not NULL.
+ */
+static ULListNode_t *_findNode(const ULList_t *list, size_t *idx,
+                               ULListNode_t **p_prev)
+{
+    ULListNode_t *prev = NULL;
+    ULListNode_t *curr = list->head;
+    while (*idx >= curr->count) {
+        *idx -= curr->count;
+        prev = curr;
+        curr = curr->next;
+    }
+    if (p_prev != NULL) {
+        *p_prev = prev;
+    }
+    return curr;
+}
+
+/**
+ * @brief
+ *  Inserts data at a position in a node, moving the upper half of the node
+ *  to a new node after it first if it's full.
+ */
+static bool _insertInNode(ULList_t *list, ULListNode_t *node, size_t pos,
+                          void *data)
+{
+    if (node->count == ULLIST_NODE_CAP) {
+        ULListNode_t *new_node = _createNode();
+        if (new_node == NULL) {
+            return false;
+        }
+        size_t half = ULLIST_NODE_CAP / 2;
+        new_node->count = ULLIST_NODE_CAP - half;
+        memcpy(new_node->data, node->data + half,
+               new_node->count * sizeof(void *));
+        node->count = half;
+        new_node->next = node->next;
+        node->next = new_node;
+        if (list->tail == node) {
+            list->tail = new_node;
+        }
+        if (pos > half) {
+            pos -= half;
+            node = new_node;
+        }
+    }
+    memmove(node->data + pos + 1, node->data + pos,
+            (node->count - pos) * sizeof(void *));
+    node->data[pos] = data;
+    node->count += 1;
+    list->count += 1;
+    return true;
+}
+
+/**
+ * @brief
+ *  Removes data at a position in a node. Unlinks the node if it's left
+ *  empty, or pulls in the next node if it's left less than half full and
+ *  both fit in one.
+ */
+static void _removeFromNode(ULList_t *list, ULListNode_t *prev,
+                            ULListNode_t *node, size_t pos,
+                            void (*free_data)(void *))
+{
+    if (free_data != NULL) {
+        free_data(node->data[pos]);
+    }
+    memmove(node->data + pos, node->data + pos + 1,
+            (node->count - pos - 1) * sizeof(void *));
+    node->count -= 1;
+    list->count -= 1;
+
+    ULListNode_t *next = node->next;
+    if (node->count == 0) {
+        if (prev == NULL) {
+            list->head = next;
+        } else {
+            prev->next = next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        free(node);
+    } else if (node->count < ULLIST_NODE_CAP / 2 && next != NULL
+               && node->count + next->count <= ULLIST_NODE_CAP) {
+        memcpy(node->data + node->count, next->data,
+               next->count * sizeof(void *));
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        free(next);
+    }
+}
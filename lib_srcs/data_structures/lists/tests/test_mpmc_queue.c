@@ -0,0 +1,204 @@
+#include "mpmc_queue.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DATA_COUNT 100000
+#define THREAD_COUNT 4
+#define CAPACITY 100
+#define BATCH 16
+
+static int values[DATA_COUNT];
+static atomic_int seen[DATA_COUNT];
+
+typedef struct Worker {
+    MpmcQueue_t *queue;
+    size_t start; // first value produced, or consumer index
+    long long sum;
+} Worker_t;
+
+/**
+ * @brief
+ *  Enqueues its share of the values, every other batch through
+ *  MpmcQueueTryEnqueueMany.
+ */
+static void *_produce(void *arg)
+{
+    Worker_t *worker = arg;
+    size_t end = worker->start + DATA_COUNT / THREAD_COUNT;
+    for (size_t i = worker->start; i < end;) {
+        if ((i / BATCH) % 2 == 0) {
+            MpmcQueueEnqueue(worker->queue, &values[i]);
+            i += 1;
+            continue;
+        }
+        void *batch[BATCH];
+        size_t batch_count = end - i < BATCH ? end - i : BATCH;
+        for (size_t j = 0; j < batch_count; j++) {
+            batch[j] = &values[i + j];
+        }
+        i += MpmcQueueTryEnqueueMany(worker->queue, batch, batch_count);
+    }
+    return NULL;
+}
+
+/**
+ * @brief
+ *  Dequeues until it gets a value of -1, alternating single and batched
+ *  dequeues.
+ */
+static void *_consume(void *arg)
+{
+    Worker_t *worker = arg;
+    worker->sum = 0;
+    while (true) {
+        void *batch[BATCH];
+        size_t batch_count;
+        if (worker->start % 2 == 0) {
+            batch[0] = MpmcQueueDequeue(worker->queue);
+            batch_count = 1;
+        } else {
+            batch_count = MpmcQueueTryDequeueMany(worker->queue, batch, BATCH);
+        }
+        for (size_t i = 0; i < batch_count; i++) {
+            int value = *(int *)batch[i];
+            if (value < 0) {
+                return NULL;
+            }
+            atomic_fetch_add(&seen[value], 1);
+            worker->sum += value;
+        }
+    }
+}
+
+static bool _test_MpmcQueueSingleThread()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    MpmcQueue_t *queue = MpmcQueueCreate(CAPACITY);
+    size_t capacity = queue->mask + 1;
+    if (capacity != 128) {
+        is_ok = false;
+        printf("capacity: res: %lu | ans: 128\n", capacity);
+    }
+    if (MpmcQueueTryDequeue(queue) != NULL) {
+        is_ok = false;
+        printf("empty dequeue: res: not NULL | ans: NULL\n");
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        if (!MpmcQueueTryEnqueue(queue, &values[i])) {
+            is_ok = false;
+            printf("enqueue: %lu \t->\t res: full | ans: not full\n", i);
+        }
+    }
+    if (MpmcQueueTryEnqueue(queue, &values[0])
+        || MpmcQueueCount(queue) != capacity) {
+        is_ok = false;
+        printf("full: res: %lu | ans: %lu\n", MpmcQueueCount(queue),
+               capacity);
+    }
+    void *batch[BATCH];
+    for (size_t i = 0; i < capacity; i += BATCH) {
+        size_t res = MpmcQueueTryDequeueMany(queue, batch, BATCH);
+        if (res != BATCH) {
+            is_ok = false;
+            printf("dequeue many: res: %lu | ans: %d\n", res, BATCH);
+        }
+        for (size_t j = 0; j < res; j++) {
+            if (batch[j] != &values[i + j]) {
+                is_ok = false;
+                printf("idx: %lu \t->\t res: %d | ans: %d\n", i + j,
+                       *(int *)batch[j], values[i + j]);
+            }
+        }
+    }
+    // batches stop where the ring is full, across the wrap around
+    for (size_t i = 0; i < capacity - 5; i++) {
+        MpmcQueueEnqueue(queue, &values[i]);
+    }
+    for (size_t i = 0; i < BATCH; i++) {
+        batch[i] = &values[i];
+    }
+    size_t res = MpmcQueueTryEnqueueMany(queue, batch, BATCH);
+    if (res != 5 || MpmcQueueTryEnqueueMany(queue, batch, BATCH) != 0) {
+        is_ok = false;
+        printf("enqueue many: res: %lu | ans: 5\n", res);
+    }
+    for (size_t i = 0; i < capacity - 5; i++) {
+        void *data = MpmcQueueDequeue(queue);
+        if (data != &values[i]) {
+            is_ok = false;
+            printf("idx: %lu \t->\t res: %d | ans: %d\n", i, *(int *)data,
+                   values[i]);
+        }
+    }
+    MpmcQueueClear(&queue, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_MpmcQueueThreads()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    MpmcQueue_t *queue = MpmcQueueCreate(CAPACITY);
+    pthread_t producers[THREAD_COUNT];
+    pthread_t consumers[THREAD_COUNT];
+    Worker_t producer_args[THREAD_COUNT];
+    Worker_t consumer_args[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        consumer_args[i] = (Worker_t){.queue = queue, .start = i};
+        pthread_create(&consumers[i], NULL, _consume, &consumer_args[i]);
+    }
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        producer_args[i] = (Worker_t){
+            .queue = queue, .start = i * (DATA_COUNT / THREAD_COUNT)};
+        pthread_create(&producers[i], NULL, _produce, &producer_args[i]);
+    }
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(producers[i], NULL);
+    }
+    // every consumer stops at the first -1 it gets
+    int stop = -1;
+    for (size_t i = 0; i < THREAD_COUNT * BATCH; i++) {
+        MpmcQueueEnqueue(queue, &stop);
+    }
+    long long sum = 0;
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(consumers[i], NULL);
+        sum += consumer_args[i].sum;
+    }
+    long long ans = (long long)DATA_COUNT * (DATA_COUNT - 1) / 2;
+    if (sum != ans) {
+        is_ok = false;
+        printf("sum: res: %lld | ans: %lld\n", sum, ans);
+    }
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        if (atomic_load(&seen[i]) != 1) {
+            is_ok = false;
+            printf("value: %lu \t->\t res: seen %d times | ans: once\n", i,
+                   atomic_load(&seen[i]));
+            break;
+        }
+    }
+    MpmcQueueClear(&queue, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        values[i] = i;
+    }
+    bool is_ok = true;
+    is_ok &= _test_MpmcQueueSingleThread();
+    is_ok &= _test_MpmcQueueThreads();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,160 @@
+#include "doubly_linked_list.h"
+#include "linked_list.h"
+#include "linked_list_kvp.h"
+#include "linked_list_queue.h"
+#include "linked_list_stack.h"
+#include "node_pool.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DATA_COUNT 1000
+
+static int values[DATA_COUNT];
+
+static int _compInt(const void *a, const void *b)
+{
+    return *(const int *)a - *(const int *)b;
+}
+
+static bool _test_NodePoolAllocFree()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    NodePool_t *pool = NodePoolCreate(sizeof(LListNode_t), 16);
+    void *nodes[DATA_COUNT];
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        nodes[i] = NodePoolAlloc(pool, sizeof(LListNode_t));
+        memset(nodes[i], 0xff, sizeof(LListNode_t));
+    }
+    if (pool->used != DATA_COUNT) {
+        is_ok = false;
+        printf("used: res: %lu | ans: %d\n", pool->used, DATA_COUNT);
+    }
+    for (size_t i = 0; i < DATA_COUNT; i += 2) {
+        NodePoolFree(pool, nodes[i]);
+    }
+    // freed nodes are handed out again, zeroed, before any new slab
+    NodePoolSlab_t *slabs = pool->slabs;
+    for (size_t i = 0; i < DATA_COUNT; i += 2) {
+        LListNode_t *node = NodePoolAlloc(pool, sizeof(LListNode_t));
+        if (node->data != NULL || node->next != NULL) {
+            is_ok = false;
+            printf("alloc: %lu \t->\t res: not zeroed | ans: zeroed\n", i);
+        }
+    }
+    if (pool->slabs != slabs || pool->used != DATA_COUNT) {
+        is_ok = false;
+        printf("reuse: res: new slab or %lu used | ans: none, %d used\n",
+               pool->used, DATA_COUNT);
+    }
+    NodePoolClear(&pool);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_LListPooled()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    LList_t *list = LListCreatePooled(NULL);
+    DLList_t *dlist = DLListCreatePooled(NULL);
+    LListKVP_t *kvp_list = LListKVPCreatePooled(_compInt, NULL);
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        LListAddTail(list, &values[i]);
+        DLListAddHead(dlist, &values[i]);
+        LListKVPAdd(kvp_list, &values[DATA_COUNT - 1 - i], &values[i]);
+    }
+    for (size_t i = 0; i < DATA_COUNT / 2; i++) {
+        LListRemoveHead(list, NULL);
+        DLListRemove(dlist, dlist->tail, NULL);
+        LListKVPRemoveHead(kvp_list, NULL, NULL);
+    }
+    for (size_t i = 0; i < DATA_COUNT / 2; i++) {
+        int *res = LListDataAt(list, i);
+        int *dres = DLListAt(dlist, i)->data;
+        int *kres = LListKVPFind(kvp_list, &values[DATA_COUNT / 2 + i]);
+        int *ans = &values[DATA_COUNT / 2 + i];
+        int *dans = &values[DATA_COUNT - 1 - i];
+        int *kans = &values[DATA_COUNT / 2 - 1 - i];
+        if (res != ans || dres != dans || kres != kans) {
+            is_ok = false;
+            printf("data at: %lu \t->\t res: %d, %d, %d | ans: %d, %d, %d\n",
+                   i, *res, *dres, *kres, *ans, *dans, *kans);
+        }
+    }
+    if (list->pool->used != DATA_COUNT / 2
+        || dlist->pool->used != DATA_COUNT / 2
+        || kvp_list->pool->used != DATA_COUNT / 2) {
+        is_ok = false;
+        printf("used: res: %lu, %lu, %lu | ans: %d\n", list->pool->used,
+               dlist->pool->used, kvp_list->pool->used, DATA_COUNT / 2);
+    }
+    LListClear(&list, NULL);
+    DLListClear(&dlist, NULL);
+    LListKVPClear(&kvp_list, NULL, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_QueueStackSharedPool()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    NodePool_t *pool = NodePoolCreate(sizeof(LListQueueNode_t), 64);
+    LListQueue_t *queue = LListQueueCreatePooled(pool);
+    LListStack_t *stack = LListStackCreatePooled(pool);
+    for (size_t round = 0; round < 4; round++) {
+        for (size_t i = 0; i < DATA_COUNT; i++) {
+            LListQueueEnqueue(queue, &values[i]);
+            LListStackPush(stack, &values[i]);
+        }
+        for (size_t i = 0; i < DATA_COUNT; i++) {
+            int *res = LListQueueDequeue(queue);
+            int *sres = LListStackPop(stack);
+            if (res != &values[i] || sres != &values[DATA_COUNT - 1 - i]) {
+                is_ok = false;
+                printf("dequeue, pop: %lu \t->\t res: %d, %d | ans: %d, %d\n",
+                       i, *res, *sres, values[i], values[DATA_COUNT - 1 - i]);
+            }
+        }
+    }
+    // the nodes of the first round are recycled by the later ones
+    size_t slab_count = 0;
+    for (NodePoolSlab_t *slab = pool->slabs; slab != NULL; slab = slab->next) {
+        slab_count++;
+    }
+    if (slab_count != (2 * DATA_COUNT + 63) / 64 || pool->refs != 3) {
+        is_ok = false;
+        printf("slabs: res: %lu, %lu refs | ans: %d, 3 refs\n", slab_count,
+               pool->refs, (2 * DATA_COUNT + 63) / 64);
+    }
+    LListQueueEnqueue(queue, &values[0]);
+    LListQueueClear(&queue, NULL);
+    LListStackClear(&stack, NULL);
+    if (pool->used != 0 || pool->refs != 1) {
+        is_ok = false;
+        printf("clear: res: %lu used, %lu refs | ans: 0 used, 1 refs\n",
+               pool->used, pool->refs);
+    }
+    NodePoolClear(&pool);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        values[i] = i;
+    }
+    bool is_ok = true;
+    is_ok &= _test_NodePoolAllocFree();
+    is_ok &= _test_LListPooled();
+    is_ok &= _test_QueueStackSharedPool();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,149 @@
+#include "spsc_queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DATA_COUNT 200000
+#define CAPACITY 100
+#define BATCH 16
+
+static int values[DATA_COUNT];
+
+typedef struct Consumer {
+    SpscQueue_t *queue;
+    bool is_ok;
+} Consumer_t;
+
+/**
+ * @brief
+ *  Enqueues all values in order, alternating single and batched enqueues.
+ */
+static void *_produce(void *arg)
+{
+    SpscQueue_t *queue = arg;
+    for (size_t i = 0; i < DATA_COUNT;) {
+        size_t added;
+        if ((i / BATCH) % 2 == 0) {
+            added = SpscQueueEnqueue(queue, &values[i]) ? 1 : 0;
+        } else {
+            void *batch[BATCH];
+            size_t batch_count
+                = DATA_COUNT - i < BATCH ? DATA_COUNT - i : BATCH;
+            for (size_t j = 0; j < batch_count; j++) {
+                batch[j] = &values[i + j];
+            }
+            added = SpscQueueEnqueueMany(queue, batch, batch_count);
+        }
+        if (added == 0) {
+            sched_yield();
+        }
+        i += added;
+    }
+    return NULL;
+}
+
+/**
+ * @brief
+ *  Dequeues all values in batches and checks they come out in order.
+ */
+static void *_consume(void *arg)
+{
+    Consumer_t *consumer = arg;
+    consumer->is_ok = true;
+    for (size_t i = 0; i < DATA_COUNT;) {
+        void *batch[BATCH];
+        size_t taken = SpscQueueDequeueMany(consumer->queue, batch, BATCH);
+        if (taken == 0) {
+            sched_yield();
+        }
+        for (size_t j = 0; j < taken; j++, i++) {
+            if (batch[j] != &values[i]) {
+                consumer->is_ok = false;
+            }
+        }
+    }
+    return NULL;
+}
+
+static bool _test_SpscQueueSingleThread()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    SpscQueue_t *queue = SpscQueueCreate(CAPACITY);
+    size_t capacity = queue->mask + 1;
+    if (capacity != 128 || SpscQueueDequeue(queue) != NULL) {
+        is_ok = false;
+        printf("create: res: %lu, not empty | ans: 128, empty\n", capacity);
+    }
+    // wrap the indices around the ring before filling it
+    for (size_t i = 0; i < capacity / 2; i++) {
+        SpscQueueEnqueue(queue, &values[i]);
+        SpscQueueDequeue(queue);
+    }
+    void *batch[CAPACITY];
+    for (size_t i = 0; i < CAPACITY; i++) {
+        batch[i] = &values[i];
+    }
+    size_t res = SpscQueueEnqueueMany(queue, batch, CAPACITY);
+    size_t res_2 = SpscQueueEnqueueMany(queue, batch, CAPACITY);
+    if (res != CAPACITY || res_2 != capacity - CAPACITY
+        || SpscQueueEnqueue(queue, &values[0])
+        || SpscQueueCount(queue) != capacity) {
+        is_ok = false;
+        printf("enqueue many: res: %lu, %lu | ans: %d, %lu\n", res, res_2,
+               CAPACITY, capacity - CAPACITY);
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        void *data = SpscQueueDequeue(queue);
+        void *ans = &values[i < CAPACITY ? i : i - CAPACITY];
+        if (data != ans) {
+            is_ok = false;
+            printf("idx: %lu \t->\t res: %p | ans: %p\n", i, data, ans);
+        }
+    }
+    if (SpscQueueDequeueMany(queue, batch, CAPACITY) != 0
+        || SpscQueueCount(queue) != 0) {
+        is_ok = false;
+        printf("empty: res: not empty | ans: empty\n");
+    }
+    SpscQueueClear(&queue, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_SpscQueueThreads()
+{
+    printf("BEGIN %s\n", __func__);
+    SpscQueue_t *queue = SpscQueueCreate(CAPACITY);
+    pthread_t producer;
+    pthread_t consumer;
+    Consumer_t consumer_arg = {.queue = queue};
+    pthread_create(&consumer, NULL, _consume, &consumer_arg);
+    pthread_create(&producer, NULL, _produce, queue);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    bool is_ok = consumer_arg.is_ok;
+    if (!is_ok) {
+        printf("order: res: out of order | ans: in order\n");
+    }
+    SpscQueueClear(&queue, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        values[i] = i;
+    }
+    bool is_ok = true;
+    is_ok &= _test_SpscQueueSingleThread();
+    is_ok &= _test_SpscQueueThreads();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,176 @@
+#include "treiber_stack.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DATA_COUNT 1000
+#define THREAD_COUNT 4
+#define BUFFER_COUNT 16
+#define ROUNDS 50000
+
+static int values[DATA_COUNT];
+
+typedef struct Buffer {
+    size_t uses;
+    bool is_held;
+} Buffer_t;
+
+typedef struct Worker {
+    TreiberStack_t *stack;
+    bool is_ok;
+} Worker_t;
+
+/**
+ * @brief
+ *  Takes buffers from the shared free-list and gives them back, checking no
+ *  other thread holds a buffer it was given.
+ */
+static void *_work(void *arg)
+{
+    Worker_t *worker = arg;
+    worker->is_ok = true;
+    for (size_t i = 0; i < ROUNDS; i++) {
+        Buffer_t *held[2];
+        size_t held_count = 0;
+        for (size_t j = 0; j < 2; j++) {
+            Buffer_t *buffer = TreiberStackPop(worker->stack);
+            if (buffer == NULL) {
+                continue;
+            }
+            if (buffer->is_held) {
+                worker->is_ok = false;
+            }
+            buffer->is_held = true;
+            buffer->uses += 1;
+            held[held_count++] = buffer;
+        }
+        for (size_t j = 0; j < held_count; j++) {
+            held[j]->is_held = false;
+            worker->is_ok &= TreiberStackPush(worker->stack, held[j]);
+        }
+    }
+    return NULL;
+}
+
+static bool _test_TreiberStackSingleThread()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    TreiberStack_t *stack = TreiberStackCreate(DATA_COUNT);
+    if (TreiberStackPop(stack) != NULL) {
+        is_ok = false;
+        printf("empty pop: res: not NULL | ans: NULL\n");
+    }
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        if (!TreiberStackPush(stack, &values[i])) {
+            is_ok = false;
+            printf("push: %lu \t->\t res: full | ans: not full\n", i);
+        }
+    }
+    if (TreiberStackPush(stack, &values[0])) {
+        is_ok = false;
+        printf("full push: res: pushed | ans: full\n");
+    }
+    for (size_t i = 0; i < DATA_COUNT / 2; i++) {
+        int *res = TreiberStackPop(stack);
+        int *ans = &values[DATA_COUNT - 1 - i];
+        if (res != ans) {
+            is_ok = false;
+            printf("idx: %lu \t->\t res: %d | ans: %d\n", i, *res, *ans);
+        }
+    }
+    // freed nodes are reused
+    for (size_t i = 0; i < DATA_COUNT / 2; i++) {
+        is_ok &= TreiberStackPush(stack, &values[i]);
+    }
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        int *res = TreiberStackPop(stack);
+        int *ans = i < DATA_COUNT / 2 ? &values[DATA_COUNT / 2 - 1 - i]
+                                      : &values[DATA_COUNT - 1 - i];
+        if (res != ans) {
+            is_ok = false;
+            printf("idx: %lu \t->\t res: %p | ans: %d\n", i, (void *)res,
+                   *ans);
+        }
+    }
+    TreiberStackClear(&stack, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_TreiberStackThreads()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    TreiberStack_t *stack = TreiberStackCreate(BUFFER_COUNT);
+    Buffer_t buffers[BUFFER_COUNT] = {0};
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        TreiberStackPush(stack, &buffers[i]);
+    }
+    pthread_t threads[THREAD_COUNT];
+    Worker_t workers[THREAD_COUNT];
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        workers[i].stack = stack;
+        pthread_create(&threads[i], NULL, _work, &workers[i]);
+    }
+    for (size_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(threads[i], NULL);
+        if (!workers[i].is_ok) {
+            is_ok = false;
+            printf("worker: %lu \t->\t res: shared buffer | ans: none\n", i);
+        }
+    }
+    // every buffer is back on the stack exactly once
+    bool is_back[BUFFER_COUNT] = {false};
+    Buffer_t *buffer;
+    size_t count = 0;
+    while ((buffer = TreiberStackPop(stack)) != NULL) {
+        size_t i = buffer - buffers;
+        if (is_back[i]) {
+            is_ok = false;
+            printf("buffer: %lu \t->\t res: twice | ans: once\n", i);
+        }
+        is_back[i] = true;
+        count += 1;
+    }
+    if (count != BUFFER_COUNT) {
+        is_ok = false;
+        printf("count: res: %lu | ans: %d\n", count, BUFFER_COUNT);
+    }
+    TreiberStackClear(&stack, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_TreiberStackClear()
+{
+    printf("BEGIN %s\n", __func__);
+    TreiberStack_t *stack = TreiberStackCreate(DATA_COUNT);
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        int *data = malloc(sizeof(int));
+        *data = i;
+        TreiberStackPush(stack, data);
+    }
+    free(TreiberStackPop(stack));
+    TreiberStackClear(&stack, free);
+    bool is_ok = stack == NULL;
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        values[i] = i;
+    }
+    bool is_ok = true;
+    is_ok &= _test_TreiberStackSingleThread();
+    is_ok &= _test_TreiberStackThreads();
+    is_ok &= _test_TreiberStackClear();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
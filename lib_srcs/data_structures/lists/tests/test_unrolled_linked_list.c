@@ -0,0 +1,206 @@
+#include "linked_list.h"
+#include "unrolled_linked_list.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DATA_COUNT 2000
+#define OP_COUNT 6000
+
+static int values[DATA_COUNT];
+
+static int _compInt(const void *a, const void *b)
+{
+    return *(const int *)a - *(const int *)b;
+}
+
+static int sum = 0;
+
+static void _addToSum(void *data)
+{
+    sum += *(int *)data;
+}
+
+static bool _checkNodes(const ULList_t *list)
+{
+    size_t count = 0;
+    const ULListNode_t *last = NULL;
+    for (ULListNode_t *curr = list->head; curr != NULL; curr = curr->next) {
+        if (curr->count == 0 || curr->count > ULLIST_NODE_CAP) {
+            printf("node count: res: %lu | ans: 1 to %d\n", curr->count,
+                   ULLIST_NODE_CAP);
+            return false;
+        }
+        count += curr->count;
+        last = curr;
+    }
+    if (count != list->count || last != list->tail) {
+        printf("list: res: %lu data, tail %p | ans: %lu data, tail %p\n",
+               count, (void *)list->tail, list->count, (void *)last);
+        return false;
+    }
+    return true;
+}
+
+static bool _checkSame(const ULList_t *list, LList_t *ref)
+{
+    if (!_checkNodes(list)) {
+        return false;
+    }
+    if (list->count != (size_t)ref->count) {
+        printf("count: res: %lu | ans: %d\n", list->count, ref->count);
+        return false;
+    }
+    void *res[OP_COUNT];
+    void *ans[OP_COUNT];
+    ULListToPointerArr(list, res, list->count);
+    LListToPointerArr(ref, ans, ref->count);
+    for (size_t i = 0; i < list->count; i++) {
+        if (res[i] != ans[i] || ULListDataAt(list, i) != ans[i]) {
+            printf("idx: %lu \t->\t res: %d | ans: %d\n", i, *(int *)res[i],
+                   *(int *)ans[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _test_ULListAddRemove()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ULList_t *list = ULListCreate();
+    LList_t *ref = LListCreate();
+    srand(42);
+    for (size_t i = 0; i < OP_COUNT && is_ok; i++) {
+        int *data = &values[rand() % DATA_COUNT];
+        size_t idx = list->count == 0 ? 0 : (size_t)rand() % list->count;
+        switch (rand() % 6) {
+        case 0:
+            ULListAddHead(list, data);
+            LListAddHead(ref, data);
+            break;
+        case 1:
+            ULListAddTail(list, data);
+            LListAddTail(ref, data);
+            break;
+        case 2:
+        case 3:
+            if (ULListAddAt(list, data, idx) != LListAddAt(ref, data, idx)) {
+                is_ok = false;
+                printf("add at: %lu \t->\t res: mismatch | ans: match\n", idx);
+            }
+            break;
+        case 4:
+            ULListRemoveHead(list, NULL);
+            LListRemoveHead(ref, NULL);
+            break;
+        default:
+            if (ULListRemoveAt(list, idx, NULL)
+                != LListRemoveAt(ref, idx, NULL)) {
+                is_ok = false;
+                printf("remove at: %lu \t->\t res: mismatch | ans: match\n",
+                       idx);
+            }
+            break;
+        }
+        if (i % 97 == 0 || list->count < 3) {
+            is_ok &= _checkSame(list, ref);
+        }
+    }
+    is_ok &= _checkSame(list, ref);
+    if (ULListDataAt(list, list->count) != NULL
+        || ULListRemoveAt(list, list->count, NULL)
+        || ULListAddAt(list, &values[0], list->count) != -1) {
+        is_ok = false;
+        printf("invalid idx: res: accepted | ans: rejected\n");
+    }
+    ULListRemoveAll(list, NULL);
+    if (list->head != NULL || list->tail != NULL || list->count != 0
+        || ULListRemoveHead(list, NULL)) {
+        is_ok = false;
+        printf("remove all: res: not empty | ans: empty\n");
+    }
+    ULListClear(&list, NULL);
+    LListClear(&ref, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ULListSearch()
+{
+    printf("BEGIN %s\n", __func__);
+    bool is_ok = true;
+    ULList_t *list = ULListCreate();
+    for (size_t i = 0; i < DATA_COUNT; i += 2) {
+        ULListAddTail(list, &values[i]);
+    }
+    for (size_t i = 1; i < DATA_COUNT; i += 2) {
+        ULListAddByCompare(list, &values[i], _compInt);
+    }
+    is_ok &= _checkNodes(list);
+    int arr[DATA_COUNT];
+    ULListToArr(list, arr, DATA_COUNT, sizeof(int));
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        size_t idx = DATA_COUNT;
+        int *res = ULListData(list, &values[i], _compInt);
+        if (arr[i] != values[i] || res != &values[i]
+            || !ULListFindIdx(list, &values[i], &idx, _compInt) || idx != i) {
+            is_ok = false;
+            printf("idx: %lu \t->\t res: %d, found at %lu | ans: %d\n", i,
+                   arr[i], idx, values[i]);
+        }
+    }
+    int key = DATA_COUNT;
+    size_t idx = 0;
+    if (ULListData(list, &key, _compInt) != NULL
+        || ULListFindIdx(list, &key, &idx, _compInt)) {
+        is_ok = false;
+        printf("missing key: res: found | ans: not found\n");
+    }
+    ULListEditAt(list, &values[0], DATA_COUNT - 1);
+    sum = 0;
+    ULListTraverse(list, _addToSum);
+    int ans = (DATA_COUNT - 2) * (DATA_COUNT - 1) / 2;
+    if (sum != ans) {
+        is_ok = false;
+        printf("traverse: res: %d | ans: %d\n", sum, ans);
+    }
+    ULListClear(&list, NULL);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+static bool _test_ULListFreeData()
+{
+    printf("BEGIN %s\n", __func__);
+    ULList_t *list = ULListCreate();
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        int *data = malloc(sizeof(int));
+        *data = i;
+        ULListAddHead(list, data);
+    }
+    for (size_t i = 0; i < DATA_COUNT / 2; i++) {
+        ULListRemoveAt(list, (i * 7) % list->count, free);
+    }
+    bool is_ok = _checkNodes(list);
+    ULListClear(&list, free);
+    printf("END %s\n", __func__);
+    return is_ok;
+}
+
+int main()
+{
+    for (size_t i = 0; i < DATA_COUNT; i++) {
+        values[i] = i;
+    }
+    bool is_ok = true;
+    is_ok &= _test_ULListAddRemove();
+    is_ok &= _test_ULListSearch();
+    is_ok &= _test_ULListFreeData();
+    if (is_ok) {
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}